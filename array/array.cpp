@@ -1,8 +1,13 @@
 #include <iostream>
 #include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <memory>
+#include <new>
 
 /**
  * @brief Dynamic array implementation with resizing capabilities
@@ -14,11 +19,63 @@
 template <typename T>
 class DynamicArray {
 private:
-    // Using unique_ptr for automatic memory management
-    std::unique_ptr<T[]> array;
+    // Trivially copyable elements are moved with memcpy/memmove instead of
+    // element by element; their storage comes from malloc so that resize can
+    // use realloc, which often grows a large block in place
+    static constexpr bool TRIVIAL = std::is_trivially_copyable_v<T>;
+    static constexpr bool USE_REALLOC = TRIVIAL && alignof(T) <= alignof(std::max_align_t);
+
+    /**
+     * @brief Frees raw storage without running destructors
+     * Only elements in [0, length) are ever constructed, and they are
+     * destroyed explicitly before the storage is released.
+     */
+    struct StorageDeleter {
+        void operator()(T* ptr) const {
+            if constexpr (USE_REALLOC) {
+                std::free(ptr);
+            } else {
+                ::operator delete(ptr, std::align_val_t{alignof(T)});
+            }
+        }
+    };
+    using Storage = std::unique_ptr<T[], StorageDeleter>;
+
+    // Using unique_ptr for automatic memory management of uninitialized storage
+    Storage array;
     size_t size;      // Total allocated capacity
     size_t length = 0; // Current number of elements
 
+    /**
+     * @brief Allocates uninitialized storage for count elements
+     * @param count Number of elements the storage must hold
+     * @return Storage in which no element is constructed yet
+     */
+    static Storage allocate(size_t count) {
+        if constexpr (USE_REALLOC) {
+            void* ptr = std::malloc(count == 0 ? 1 : count * sizeof(T));
+            if (ptr == nullptr) {
+                throw std::bad_alloc();
+            }
+            return Storage(static_cast<T*>(ptr));
+        } else {
+            return Storage(static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{alignof(T)})));
+        }
+    }
+
+    /**
+     * @brief Destroys the elements in [from, to)
+     * @param from First element to destroy
+     * @param to One past the last element to destroy
+     */
+    void destroy(size_t from, size_t to) {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = from; i < to; i++) {
+                array[i].~T();
+            }
+        }
+    }
+
     /**
      * @brief Resizes the array to a new capacity
      * @param newSize The new capacity to allocate
@@ -56,24 +113,23 @@ public:
      * @brief Constructs an array with optional initial capacity
      * @param size Initial capacity of the array (default: 10)
      */
-    explicit DynamicArray(size_t size = 10) : array(new T[size]), size(size), length(0) {}
+    explicit DynamicArray(size_t size = 10) : array(allocate(size)), size(size), length(0) {}
     
     // Rule of five implementation for proper resource management
     
     /**
-     * @brief Destructor - handled automatically by unique_ptr
+     * @brief Destructor - destroys live elements, unique_ptr frees the storage
      */
-    ~DynamicArray() = default;
+    ~DynamicArray() { destroy(0, length); }
     
     /**
      * @brief Copy constructor - creates a deep copy
      * @param other Array to copy from
      */
-    DynamicArray(const DynamicArray& other) : array(new T[other.size]), size(other.size), length(other.length) {
-        // Deep copy all elements
-        for (size_t i = 0; i < length; i++) {
-            array[i] = other.array[i];
-        }
+    DynamicArray(const DynamicArray& other) : array(allocate(other.size)), size(other.size), length(0) {
+        // Deep copy all elements into the uninitialized storage
+        std::uninitialized_copy(other.array.get(), other.array.get() + other.length, array.get());
+        length = other.length;
     }
     
     /**
@@ -84,10 +140,9 @@ public:
     DynamicArray& operator=(const DynamicArray& other) {
         if (this != &other) {
             // Create new array and copy elements before replacing current array
-            std::unique_ptr<T[]> newArray(new T[other.size]);
-            for (size_t i = 0; i < other.length; i++) {
-                newArray[i] = other.array[i];
-            }
+            Storage newArray = allocate(other.size);
+            std::uninitialized_copy(other.array.get(), other.array.get() + other.length, newArray.get());
+            destroy(0, length);
             array = std::move(newArray);
             size = other.size;
             length = other.length;
@@ -113,6 +168,7 @@ public:
      */
     DynamicArray& operator=(DynamicArray&& other) noexcept {
         if (this != &other) {
+            destroy(0, length);
             array = std::move(other.array);
             size = other.size;
             length = other.length;
@@ -339,28 +395,47 @@ public:
      * @brief Removes all elements from the array
      * May shrink capacity if appropriate
      */
-    void clear() { length = 0; tryShrink(); }
+    void clear() { destroy(0, length); length = 0; tryShrink(); }
 };
 
 /**
  * @brief Resizes the array to a new capacity
  * 
- * Creates a new array of the specified size and moves all existing elements.
- * The old array is automatically deleted when the unique_ptr is reassigned.
+ * Allocates uninitialized storage of the specified size and move-constructs
+ * the existing elements into it; the slots beyond length stay unconstructed.
+ * The old storage is freed when the unique_ptr is reassigned.
+ * Trivially copyable elements are copied as raw bytes, and with realloc
+ * when their alignment allows, so the block may grow in place.
  * 
  * @param newSize The new capacity to allocate
  */
 template <typename T>
 void DynamicArray<T>::resize(size_t newSize) {
-    // Create new array with new size
-    std::unique_ptr<T[]> newArray(new T[newSize]);
+    if constexpr (USE_REALLOC) {
+        // realloc extends the block in place when it can and copies the
+        // bytes otherwise; on failure the old block is left untouched
+        void* ptr = std::realloc(array.get(), newSize == 0 ? 1 : newSize * sizeof(T));
+        if (ptr == nullptr) {
+            throw std::bad_alloc();
+        }
+        array.release();
+        array.reset(static_cast<T*>(ptr));
+        size = newSize;
+        return;
+    }
+
+    // Allocate raw storage, constructing nothing yet
+    Storage newArray = allocate(newSize);
     
-    // Move existing elements to new array
-    for (size_t i = 0; i < length; i++) {
-        newArray[i] = std::move(array[i]);
+    // Move existing elements into the new storage
+    if constexpr (TRIVIAL) {
+        std::memcpy(static_cast<void*>(newArray.get()), static_cast<const void*>(array.get()), length * sizeof(T));
+    } else {
+        std::uninitialized_move(array.get(), array.get() + length, newArray.get());
     }
     
-    // Replace old array with new one (old array automatically deleted)
+    // Destroy the moved-from elements, then replace the old storage
+    destroy(0, length);
     array = std::move(newArray);
     size = newSize;
 }
@@ -408,10 +483,15 @@ template <typename T>
 void DynamicArray<T>::append(const T& value) {
     // Double capacity if full
     if (length >= size) {
+        // value may be an element of this array, which resize moves away
+        T element(value);
         resize(size == 0 ? 1 : size * 2);
+        new (&array[length]) T(std::move(element));
+    } else {
+        // Construct the new element in place
+        new (&array[length]) T(value);
     }
-    // Add new element and increment length
-    array[length++] = value;
+    ++length;
 }
 
 /**
@@ -429,25 +509,36 @@ void DynamicArray<T>::insert(size_t index, const T& value) {
         throw std::out_of_range("Index out of range");
     }
     
+    // Copy first: value may be an element that resizing or shifting moves
+    T element(value);
+    
     // Double capacity if full
     if (length >= size) {
         resize(size == 0 ? 1 : size * 2);
     }
     
-    // Shift elements to make space
-    for (size_t i = length; i > index; i--) {
-        array[i] = std::move(array[i - 1]);
+    if constexpr (TRIVIAL) {
+        // One memmove opens the gap; the bytes of element are copied into it
+        std::memmove(static_cast<void*>(&array[index + 1]), static_cast<const void*>(&array[index]),
+                     (length - index) * sizeof(T));
+        new (&array[index]) T(element);
+    } else if (index == length) {
+        new (&array[length]) T(std::move(element));
+    } else {
+        // The last element moves into unconstructed storage, the rest shift over live ones
+        new (&array[length]) T(std::move(array[length - 1]));
+        for (size_t i = length - 1; i > index; i--) {
+            array[i] = std::move(array[i - 1]);
+        }
+        array[index] = std::move(element);
     }
-    
-    // Insert new element and increment length
-    array[index] = value;
     ++length;
 }
 
 /**
  * @brief Removes the last element from the array
  * 
- * Decreases length by 1 but doesn't actually modify the element.
+ * Destroys the last element and decreases length by 1.
  * May shrink the array if it becomes too empty.
  * 
  * @throws std::out_of_range if array is empty
@@ -457,8 +548,9 @@ void DynamicArray<T>::pop() {
     if (length == 0) {
         throw std::out_of_range("Array is empty");
     }
-    // Just decrease the length - no need to modify the element
+    // Destroy the element, leaving its slot unconstructed
     --length;
+    array[length].~T();
     // Check if we should shrink the array
     tryShrink();
 }
@@ -478,12 +570,18 @@ void DynamicArray<T>::delete_item(size_t index) {
     }
     
     // Shift elements to fill the gap
-    for (size_t i = index; i < length - 1; i++) {
-        array[i] = std::move(array[i + 1]);
+    if constexpr (TRIVIAL) {
+        std::memmove(static_cast<void*>(&array[index]), static_cast<const void*>(&array[index + 1]),
+                     (length - index - 1) * sizeof(T));
+    } else {
+        for (size_t i = index; i < length - 1; i++) {
+            array[i] = std::move(array[i + 1]);
+        }
     }
     
-    // Decrease length and possibly shrink array
+    // Destroy the now moved-from last element, decrease length and possibly shrink array
     --length;
+    array[length].~T();
     tryShrink();
 }
 
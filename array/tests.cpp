@@ -1,6 +1,8 @@
 #include <iostream>
 #include <cassert>
+#include <cstdint>
 #include <string>
+#include <vector>
 #include "array.cpp"  // Include your Array implementation
 
 // Test counter
@@ -318,6 +320,91 @@ void testIterator() {
     });
 }
 
+// Element type that counts live objects and has no default constructor
+struct Tracked {
+    static int live;
+    int value;
+    explicit Tracked(int value) : value(value) { live++; }
+    Tracked(const Tracked& other) : value(other.value) { live++; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { live++; }
+    Tracked& operator=(const Tracked& other) = default;
+    Tracked& operator=(Tracked&& other) noexcept = default;
+    ~Tracked() { live--; }
+};
+
+int Tracked::live = 0;
+
+void testUninitializedStorage() {
+    RUN_TEST("Storage - Only Live Elements Are Constructed", {
+        {
+            DynamicArray<Tracked> arr(1000);
+            assert(Tracked::live == 0);  // Capacity alone constructs nothing
+            for (int i = 0; i < 3000; i++) {
+                arr.append(Tracked(i));
+            }
+            assert(Tracked::live == 3000);  // Growing constructs no spare slots
+            arr.insert(1, Tracked(-1));
+            arr.delete_item(0);
+            arr.pop();
+            assert(Tracked::live == 2999);
+            assert(arr[0].value == -1 && arr[1].value == 1);
+            DynamicArray<Tracked> copy(arr);
+            assert(Tracked::live == 2 * 2999);
+            copy.clear();
+            assert(Tracked::live == 2999);
+        }
+        assert(Tracked::live == 0);  // Destructor destroys every live element
+    });
+    
+    RUN_TEST("Storage - Appending an Element of the Same Array", {
+        DynamicArray<std::string> arr(1);
+        arr.append("first");
+        arr.append(arr[0]);  // Forces a resize while value refers into the array
+        arr.insert(0, arr[1]);
+        assert(arr.get_length() == 3);
+        assert(arr[0] == "first" && arr[1] == "first" && arr[2] == "first");
+    });
+}
+
+// Trivially copyable element wider than malloc's alignment
+struct alignas(64) Wide {
+    int value;
+};
+
+void testTriviallyCopyable() {
+    RUN_TEST("Trivial - Insert and Delete Match std::vector", {
+        DynamicArray<int> arr(1);
+        std::vector<int> expected;
+        for (int i = 0; i < 2000; i++) {
+            size_t index = (static_cast<size_t>(i) * 7919) % (expected.size() + 1);
+            arr.insert(index, i);
+            expected.insert(expected.begin() + index, i);
+        }
+        for (int i = 0; i < 1500; i++) {
+            size_t index = (static_cast<size_t>(i) * 104729) % expected.size();
+            arr.delete_item(index);
+            expected.erase(expected.begin() + index);
+        }
+        assert(arr.get_length() == expected.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            assert(arr[i] == expected[i]);
+        }
+    });
+    
+    RUN_TEST("Trivial - Over-Aligned Elements", {
+        DynamicArray<Wide> arr(1);
+        for (int i = 0; i < 100; i++) {
+            arr.insert(0, Wide{i});
+        }
+        arr.delete_item(50);
+        assert(arr.get_length() == 99);
+        assert(arr[0].value == 99 && arr[50].value == 48 && arr[98].value == 0);
+        for (size_t i = 0; i < arr.get_length(); i++) {
+            assert(reinterpret_cast<uintptr_t>(&arr[i]) % alignof(Wide) == 0);
+        }
+    });
+}
+
 // Exception tests need special handling with assert
 void testExceptions() {
     // Index out of range
@@ -386,6 +473,8 @@ int main() {
     testArrayManipulation();
     testCopyMove();
     testIterator();
+    testUninitializedStorage();
+    testTriviallyCopyable();
     testExceptions();
     
     // Print summary
@@ -0,0 +1,80 @@
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Blocked (split-block) Bloom filter over precomputed 64-bit hashes.
+//
+// The filter is an array of 64-byte blocks, each one cache line of eight
+// 64-bit words. The high half of a hash picks the block and the low half sets
+// one bit in each word of it, so insert and may_contain touch exactly one
+// cache line. Bits are never cleared; owners that remove keys rebuild the
+// filter from their remaining hashes now and then.
+class BlockedBloomFilter {
+private:
+    static constexpr size_t WORDS = 8;           // 64-bit words per block
+    static constexpr size_t BITS_PER_KEY = 10;   // About 1% false positives when full
+
+    // Odd multipliers giving each word an independent bit position
+    static constexpr uint32_t SALT[WORDS] = {0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du,
+                                             0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u};
+
+    struct alignas(64) Block {
+        uint64_t words[WORDS];
+    };
+
+    std::vector<Block> blocks; // Number of blocks is a power of two
+    size_t blockMask = 0;      // blocks.size() - 1
+
+    const Block &blockFor(uint64_t hash) const { return blocks[(hash >> 32) & blockMask]; }
+
+    // Bit set in word i for a hash
+    static uint64_t bitFor(uint64_t hash, size_t i) {
+        return uint64_t{1} << ((static_cast<uint32_t>(hash) * SALT[i]) >> 26);
+    }
+
+public:
+    // Constructor sizing the filter for expectedKeys keys
+    explicit BlockedBloomFilter(size_t expectedKeys = 0) { reset(expectedKeys); };
+
+    // Method to clear the filter and resize it for expectedKeys keys
+    void reset(size_t expectedKeys) {
+        size_t needed = (expectedKeys * BITS_PER_KEY + WORDS * 64 - 1) / (WORDS * 64);
+        size_t count = 1;
+        while (count < needed) {
+            count <<= 1;
+        }
+        blocks.assign(count, Block{});
+        blockMask = count - 1;
+    }
+
+    // Method to add a hash to the filter
+    void insert(uint64_t hash) {
+        Block &block = blocks[(hash >> 32) & blockMask];
+        for (size_t i = 0; i < WORDS; ++i) {
+            block.words[i] |= bitFor(hash, i);
+        }
+    }
+
+    // Method to start loading the block a hash maps to, ahead of a may_contain
+    void prefetch(uint64_t hash) const { __builtin_prefetch(&blockFor(hash)); }
+
+    // Method to check a hash: false means it was never inserted, true means
+    // it probably was
+    bool may_contain(uint64_t hash) const {
+        const Block &block = blockFor(hash);
+        for (size_t i = 0; i < WORDS; ++i) {
+            if ((block.words[i] & bitFor(hash, i)) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Method to get the number of 64-byte blocks
+    size_t block_count() const { return blocks.size(); }
+};
+
+#endif // BLOOM_FILTER_H
@@ -1,45 +1,112 @@
 #ifndef BUCKET_H
 #define BUCKET_H
 
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <utility>
 #include <stdexcept> 
 
+// Fields are ordered by how often a chain walk touches them: next, the
+// cached hash and the key come first (std::string keeps keys up to 15 chars
+// inline), so a rejected node only reads its first 48 bytes.
+// Nodes are not cache-line aligned: Node<string, int> is 64 bytes but comes
+// from a 16-byte-aligned allocator, so a node, and half the time those first
+// 48 bytes, span two cache lines.
 template <typename T, typename U>
 class Node
 {
 public:
+    Node *next;        // Pointer to the next node
+    uint64_t hash;     // Cached hash of the key (0 when the owner does not hash)
     T key;             // Key of the node
     U value;           // Value associated with the key
-    Node *next;        // Pointer to the next node
     Node *prev;        // Pointer to the previous node
 
     // Constructors
-    Node() : key{}, value{}, next{nullptr}, prev{nullptr} {};
-    Node(const T &keyA, const U &valueA) : key{keyA}, value{valueA}, next{nullptr}, prev{nullptr} {};
+    Node() : next{nullptr}, hash{0}, key{}, value{}, prev{nullptr} {};
+    Node(const T &keyA, const U &valueA, uint64_t hashA = 0)
+        : next{nullptr}, hash{hashA}, key{keyA}, value{valueA}, prev{nullptr} {};
+
+    // Constructor building the key from keyA and the value in place from args
+    template <typename K, typename... Args>
+    Node(std::piecewise_construct_t, uint64_t hashA, K &&keyA, Args &&...args)
+        : next{nullptr}, hash{hashA}, key(std::forward<K>(keyA)), value(std::forward<Args>(args)...), prev{nullptr} {};
 };
 
-template <typename T, typename U>
+// Alloc allocates Node<T, U> objects. Buckets that exchange nodes through
+// link/unlinkHead must use allocators that compare equal.
+template <typename T, typename U, typename Alloc = std::allocator<Node<T, U>>>
 class Bucket
 {
 private:
     int size;          // Size of the linked list
+    Alloc alloc;       // Allocator for the nodes
 
-
+    // Private methods to allocate/free a single node through alloc
+    template <typename... Args>
+    Node<T, U> *createNode(Args &&...args);
+    void destroyNode(Node<T, U> *node);
 
 public:
+    using NodeType = Node<T, U>;
+
     Node<T, U> *head;  // Pointer to the head of the linked list
     Node<T, U> *tail;  // Pointer to the tail of the linked list
     // Constructor
-    Bucket() : head{nullptr}, tail{nullptr}, size{0} {};
+    explicit Bucket(const Alloc &allocA = Alloc()) : size{0}, alloc{allocA}, head{nullptr}, tail{nullptr} {};
+
+    Bucket(const Bucket &) = delete;
+    Bucket &operator=(const Bucket &) = delete;
+
+    // Method to push a key-value pair into the linked list.
+    // hashA is stored in the node; owners that pass hashes must pass them
+    // consistently, because lookups with a hash compare it first.
+    // Returns true if a new node was added, false if an existing one was updated.
+    // equal compares stored keys with keyA (operator== by default).
+    // Rvalue keys and values are moved into the node instead of copied.
+    template <typename K, typename V, typename Equal = std::equal_to<>>
+    bool push(K &&keyA, V &&valueA, uint64_t hashA = 0, const Equal &equal = Equal());
+
+    // Method to find a key or append a node whose value is constructed in
+    // place from args. Returns the node and whether it was added; keyA and
+    // args are left untouched when the key already exists.
+    template <typename K, typename Equal, typename... Args>
+    std::pair<Node<T, U> *, bool> try_emplace(K &&keyA, uint64_t hashA, const Equal &equal, Args &&...args);
+
+    // Method to append an existing node whose key is known to be absent.
+    // No lookup and no allocation: the Bucket takes ownership of the node.
+    void link(Node<T, U> *node);
+
+    // Method to detach the head node without freeing it (nullptr if empty)
+    Node<T, U> *unlinkHead();
+
+    // Method to get a node with a specific key.
+    // Any type comparable with T works (e.g. string_view for string keys),
+    // so lookups do not have to construct a T.
+    template <typename K>
+    Node<T, U> *get(const K &keyA);
 
-    // Method to push a key-value pair into the linked list
-    void push(const T &keyA, const U &valueA);
+    // Method to get a node by key and cached hash. Nodes whose hash differs
+    // are rejected without comparing keys; the rest are compared with equal.
+    template <typename K, typename Equal = std::equal_to<>>
+    Node<T, U> *get(const K &keyA, uint64_t hashA, const Equal &equal = Equal());
 
-    // Method to get a node with a specific key
-    Node<T, U> *get(const T &keyA);
+    // Method to get a node like above and add the number of nodes visited to probes
+    template <typename K, typename Equal>
+    Node<T, U> *get(const K &keyA, uint64_t hashA, const Equal &equal, size_t &probes);
 
     // Method to remove a node with a specific key
-    bool remove(const T &key);
+    template <typename K>
+    bool remove(const K &keyA);
+
+    // Method to remove a node with a specific key and cached hash
+    template <typename K, typename Equal = std::equal_to<>>
+    bool remove(const K &keyA, uint64_t hashA, const Equal &equal = Equal());
+
+    // Method to unlink and free a node of this Bucket (false for nullptr)
+    bool erase(Node<T, U> *node);
     // Method to check if the linked list is empty
     bool empty();
     ~Bucket();
@@ -47,52 +114,113 @@ public:
 
 // Method definitions
 
-template <typename T, typename U>
-void Bucket<T, U>::push(const T &keyA, const U &valueA)
-{   
+template <typename T, typename U, typename Alloc>
+template <typename... Args>
+Node<T, U> *Bucket<T, U, Alloc>::createNode(Args &&...args)
+{
+    Node<T, U> *node = std::allocator_traits<Alloc>::allocate(alloc, 1);
+    try
+    {
+        std::allocator_traits<Alloc>::construct(alloc, node, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        std::allocator_traits<Alloc>::deallocate(alloc, node, 1);
+        throw;
+    }
+    return node;
+}
 
-   
-    // Check if the node with the given key already exists
-    Node<T, U> *existedNode = get(keyA);
+template <typename T, typename U, typename Alloc>
+void Bucket<T, U, Alloc>::destroyNode(Node<T, U> *node)
+{
+    std::allocator_traits<Alloc>::destroy(alloc, node);
+    std::allocator_traits<Alloc>::deallocate(alloc, node, 1);
+}
 
-    if (existedNode != nullptr)
+template <typename T, typename U, typename Alloc>
+template <typename K, typename V, typename Equal>
+bool Bucket<T, U, Alloc>::push(K &&keyA, V &&valueA, uint64_t hashA, const Equal &equal)
+{
+    // valueA is only consumed when a new node is created
+    std::pair<Node<T, U> *, bool> result = try_emplace(std::forward<K>(keyA), hashA, equal, std::forward<V>(valueA));
+    if (!result.second)
     {
         // If the node exists, update its value
-        existedNode->value = valueA;
+        result.first->value = std::forward<V>(valueA);
+    }
+    return result.second;
+}
+
+template <typename T, typename U, typename Alloc>
+template <typename K, typename Equal, typename... Args>
+std::pair<Node<T, U> *, bool> Bucket<T, U, Alloc>::try_emplace(K &&keyA, uint64_t hashA, const Equal &equal, Args &&...args)
+{
+    // Check if the node with the given key already exists
+    Node<T, U> *existedNode = get(keyA, hashA, equal);
+    if (existedNode != nullptr)
+    {
+        return {existedNode, false};
+    }
+
+    // If the node doesn't exist, build it in place and append it to the end
+    Node<T, U> *newNode = createNode(std::piecewise_construct, hashA, std::forward<K>(keyA), std::forward<Args>(args)...);
+    link(newNode);
+    return {newNode, true};
+}
+
+template <typename T, typename U, typename Alloc>
+void Bucket<T, U, Alloc>::link(Node<T, U> *node)
+{
+    node->next = nullptr;
+    node->prev = tail;
+
+    if (head == nullptr)
+    {
+        // If the list is empty, the node becomes both head and tail
+        head = node;
     }
     else
     {
-        // If the node doesn't exist, create a new node
-        Node<T, U> *newNode = new Node(keyA, valueA);
+        tail->next = node;
+    }
+    tail = node;
+    size++;
+}
 
-        // Check if the list is empty
-        if (head == nullptr)
-        {
-            // If the list is empty, the new node becomes both head and tail
-            head = newNode;
-            tail = newNode;
-        }
-        else
-        {
-            // If the list is not empty, append the new node to the end
-            tail->next = newNode;
-            newNode->prev = tail;
-            tail = newNode;
-        }
+template <typename T, typename U, typename Alloc>
+Node<T, U> *Bucket<T, U, Alloc>::unlinkHead()
+{
+    Node<T, U> *node = head;
+    if (node == nullptr)
+    {
+        return nullptr;
+    }
 
-        // Increment the size of the linked list
-        size++;
+    head = node->next;
+    if (head != nullptr)
+    {
+        head->prev = nullptr;
+    }
+    else
+    {
+        tail = nullptr;
     }
+    node->next = nullptr;
+    size--;
+
+    return node;
 }
 
-template <typename T, typename U>
-bool Bucket<T, U>::empty()
+template <typename T, typename U, typename Alloc>
+bool Bucket<T, U, Alloc>::empty()
 {
     return size == 0;
 }
 
-template <typename T, typename U>
-Node<T, U> *Bucket<T, U>::get(const T &keyA)
+template <typename T, typename U, typename Alloc>
+template <typename K>
+Node<T, U> *Bucket<T, U, Alloc>::get(const K &keyA)
 {
     // Traverse the linked list to find a node with the specified key
     Node<T, U> *currNode = head;
@@ -111,12 +239,61 @@ Node<T, U> *Bucket<T, U>::get(const T &keyA)
     return nullptr;
 }
 
-template <typename T, typename U>
-bool Bucket<T, U>::remove(const T &keyA)
+template <typename T, typename U, typename Alloc>
+template <typename K, typename Equal>
+Node<T, U> *Bucket<T, U, Alloc>::get(const K &keyA, uint64_t hashA, const Equal &equal)
 {
-    // Get the node to delete
-    Node<T, U> *nodeToDelete = get(keyA);
+    // Same traversal, but the cheap hash comparison filters out almost
+    // every non-matching node before the key comparison
+    Node<T, U> *currNode = head;
+    while (currNode)
+    {
+        if (currNode->hash == hashA && equal(currNode->key, keyA))
+        {
+            return currNode;
+        }
+        currNode = currNode->next;
+    }
+
+    return nullptr;
+}
 
+template <typename T, typename U, typename Alloc>
+template <typename K, typename Equal>
+Node<T, U> *Bucket<T, U, Alloc>::get(const K &keyA, uint64_t hashA, const Equal &equal, size_t &probes)
+{
+    Node<T, U> *currNode = head;
+    while (currNode)
+    {
+        probes++;
+        if (currNode->hash == hashA && equal(currNode->key, keyA))
+        {
+            return currNode;
+        }
+        currNode = currNode->next;
+    }
+
+    return nullptr;
+}
+
+template <typename T, typename U, typename Alloc>
+template <typename K>
+bool Bucket<T, U, Alloc>::remove(const K &keyA)
+{
+    // Get the node to delete and unlink it
+    return erase(get(keyA));
+}
+
+template <typename T, typename U, typename Alloc>
+template <typename K, typename Equal>
+bool Bucket<T, U, Alloc>::remove(const K &keyA, uint64_t hashA, const Equal &equal)
+{
+    return erase(get(keyA, hashA, equal));
+}
+
+template <typename T, typename U, typename Alloc>
+bool Bucket<T, U, Alloc>::erase(Node<T, U> *nodeToDelete)
+{
     // Check if the node exists or the list is empty
     if (nodeToDelete == nullptr || empty())
     {
@@ -133,6 +310,11 @@ bool Bucket<T, U>::remove(const T &keyA)
         {
             head->prev = nullptr;
         }
+        else
+        {
+            // The list is now empty
+            tail = nullptr;
+        }
     }
     // Check if the node to delete is the tail
     else if (nodeToDelete == tail)
@@ -154,19 +336,19 @@ bool Bucket<T, U>::remove(const T &keyA)
     }
 
     // Delete the node and decrement the size of the linked list
-    delete nodeToDelete;
+    destroyNode(nodeToDelete);
     size--;
 
     return true;
 }
 
 
-template <typename T, typename U>
-Bucket<T,U>::~Bucket() {
+template <typename T, typename U, typename Alloc>
+Bucket<T, U, Alloc>::~Bucket() {
     while (head != nullptr) {
             Node<T, U>* temp = head;
             head = head->next;
-            delete temp;
+            destroyNode(temp);
         }
 
 }
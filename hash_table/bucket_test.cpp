@@ -28,6 +28,32 @@ void testBucket() {
     bucket.remove("key1");
     bucket.remove("key3");
     assert(bucket.empty() == true); // Empty after removals
+
+    // Test case 5: Moving nodes between buckets without copying
+    Bucket<string, int> other;
+    bucket.push("key5", 5);
+    bucket.push("key6", 6);
+    Node<string, int> *moved = bucket.unlinkHead();
+    assert(moved->key == "key5");
+    other.link(moved);
+    assert(other.get("key5") == moved); // Same node, now owned by the other bucket
+    assert(bucket.get("key5") == nullptr);
+    other.link(bucket.unlinkHead());
+    assert(bucket.empty() == true);
+    assert(bucket.unlinkHead() == nullptr);
+    assert(other.tail->key == "key6" && other.tail->prev == moved);
+
+    // Test case 6: Cached hashes reject nodes before comparing keys
+    Bucket<string, int> hashed;
+    hashed.push("key1", 1, 111);
+    hashed.push("key2", 2, 222);
+    assert(hashed.get("key1", 111)->value == 1);
+    assert(hashed.get("key1", 222) == nullptr); // Hash mismatch, key never compared
+    hashed.push("key1", 10, 111); // Update through the hashed lookup
+    assert(hashed.get("key1")->value == 10);
+    assert(hashed.remove("key2", 111) == false);
+    assert(hashed.remove("key2", 222) == true);
+    assert(hashed.head == hashed.tail);
 }
 
 int main() {
@@ -0,0 +1,124 @@
+#ifndef CONCURRENT_HASH_TABLE_H
+#define CONCURRENT_HASH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+#include "hashTable.h" // Each shard is a regular HashTable
+
+using namespace std;
+
+// Thread-safe HashTable split into independently locked shards.
+//
+// The high bits of a key's hash pick the shard and the low bits pick the
+// Bucket inside it, so both levels stay well distributed with one hash.
+// Every shard has its own reader-writer lock: has/get on different keys (or
+// on the same shard) run in parallel, and set/remove only block their shard.
+template <typename U, typename Hash = WyHash>
+class ConcurrentHashTable {
+private:
+    // Padded to a cache line so neighbouring locks do not false-share
+    struct alignas(64) Shard {
+        mutable shared_mutex lock;
+        HashTable<U, Hash> table;
+
+        explicit Shard(const Hash &hasher) : table{hasher} {};
+    };
+
+    vector<unique_ptr<Shard>> shards; // One HashTable per shard
+    unsigned shardBits = 0; // log2 of the number of shards
+    Hash hasher; // Hash function object shared with every shard
+
+    // Private method to find the shard that owns a key's hash
+    Shard &shardFor(uint64_t hash) const;
+
+public:
+    // Constructor; shardCount is rounded up to a power of two
+    explicit ConcurrentHashTable(size_t shardCount = 16, const Hash &hasher = Hash());
+
+    // Method to check if a key exists in the ConcurrentHashTable
+    bool has(const string &key) const;
+
+    // Method to get the value associated with a key
+    U get(const string &key) const;
+
+    // Method to set a key-value pair in the ConcurrentHashTable
+    void set(const string &key, const U &value);
+
+    // Method to remove a key-value pair from the ConcurrentHashTable
+    bool remove(const string &key);
+
+    // Method to get the number of shards
+    size_t shard_count() const { return shards.size(); }
+};
+
+// Definition of the constructor
+template <typename U, typename Hash>
+ConcurrentHashTable<U, Hash>::ConcurrentHashTable(size_t shardCount, const Hash &hasher) : hasher{hasher} {
+    while ((size_t{1} << shardBits) < shardCount) {
+        shardBits++;
+    }
+    for (size_t i = 0; i < (size_t{1} << shardBits); ++i) {
+        shards.push_back(make_unique<Shard>(hasher));
+    }
+}
+
+// Definition of the shardFor method
+template <typename U, typename Hash>
+typename ConcurrentHashTable<U, Hash>::Shard &ConcurrentHashTable<U, Hash>::shardFor(uint64_t hash) const {
+    if (shardBits == 0) {
+        return *shards[0];
+    }
+    return *shards[hash >> (64 - shardBits)];
+}
+
+// Every operation hashes its key once, outside the lock, and hands the hash
+// to the shard's private hashed entry points: shards use a copy of hasher, so
+// it is the hash they would compute themselves.
+
+// Shards never enable incremental rehashing or the Bloom filter, so
+// HashTable::has and HashTable::get leave the table's structure untouched and
+// are safe under a shared lock. With -DHASH_TABLE_STATS they do update the
+// lookup counters, which are relaxed atomics for this reason.
+
+// Definition of the has method
+template <typename U, typename Hash>
+bool ConcurrentHashTable<U, Hash>::has(const string &key) const {
+    uint64_t hash = hasher(key);
+    Shard &shard = shardFor(hash);
+    shared_lock<shared_mutex> guard(shard.lock);
+    return shard.table.hasHashed(key, hash);
+}
+
+// Definition of the get method
+template <typename U, typename Hash>
+U ConcurrentHashTable<U, Hash>::get(const string &key) const {
+    uint64_t hash = hasher(key);
+    Shard &shard = shardFor(hash);
+    shared_lock<shared_mutex> guard(shard.lock);
+    return shard.table.getHashed(key, hash);
+}
+
+// Definition of the set method
+template <typename U, typename Hash>
+void ConcurrentHashTable<U, Hash>::set(const string &key, const U &value) {
+    uint64_t hash = hasher(key);
+    Shard &shard = shardFor(hash);
+    unique_lock<shared_mutex> guard(shard.lock);
+    shard.table.insertHashed(key, value, hash);
+}
+
+// Definition of the remove method
+template <typename U, typename Hash>
+bool ConcurrentHashTable<U, Hash>::remove(const string &key) {
+    uint64_t hash = hasher(key);
+    Shard &shard = shardFor(hash);
+    unique_lock<shared_mutex> guard(shard.lock);
+    return shard.table.removeHashed(key, hash);
+}
+
+#endif // CONCURRENT_HASH_TABLE_H
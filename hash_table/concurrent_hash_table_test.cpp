@@ -0,0 +1,126 @@
+#include <iostream>
+#include <atomic>
+#include <cassert>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "concurrentHashTable.h"
+
+using namespace std;
+
+// Hasher that counts its calls, to check how often keys are hashed
+struct CountingHash {
+    static atomic<size_t> calls;
+    uint64_t operator()(string_view key) const {
+        calls++;
+        return WyHash()(key);
+    }
+};
+atomic<size_t> CountingHash::calls{0};
+
+// Function to run tests for the ConcurrentHashTable class
+void runTests() {
+    // Test case 1: Single-threaded behaviour matches HashTable
+    ConcurrentHashTable<int> table(5);
+    assert(table.shard_count() == 8); // Rounded up to a power of two
+    table.set("key1", 10);
+    table.set("key2", 20);
+    assert(table.get("key1") == 10);
+    assert(table.remove("key2") == true);
+    assert(table.has("key2") == false);
+    assert(table.get("key2") == 0);
+
+    // Test case 2: Concurrent writers on disjoint keys, readers on shared keys
+    const int threads = 8;
+    const int perThread = 2000;
+    vector<thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&table, t]() {
+            for (int i = 0; i < perThread; ++i) {
+                table.set("t" + to_string(t) + "_" + to_string(i), i);
+                assert(table.get("key1") == 10);
+            }
+        });
+    }
+    for (thread &worker : workers) {
+        worker.join();
+    }
+    for (int t = 0; t < threads; ++t) {
+        for (int i = 0; i < perThread; ++i) {
+            assert(table.get("t" + to_string(t) + "_" + to_string(i)) == i);
+        }
+    }
+
+    // Test case 3: Picking the shard and probing it share one hash per call
+    ConcurrentHashTable<int, CountingHash> counted(4);
+    for (int i = 0; i < 1000; ++i) {
+        counted.set("key" + to_string(i), i);
+    }
+    CountingHash::calls = 0;
+    counted.set("key6", 60); // An update, so no shard resizes
+    assert(counted.get("key7") == 7);
+    assert(counted.has("key8") == true);
+    assert(counted.remove("key9") == true);
+    assert(counted.has("key9") == false);
+    assert(CountingHash::calls == 5);
+}
+
+#ifdef HASH_TABLE_STATS
+// Only built with -DHASH_TABLE_STATS: concurrent readers share the lookup counters
+void runStatsTests() {
+    HashTable<int> hashTable;
+    for (int i = 0; i < 100; ++i) {
+        hashTable.set("key" + to_string(i), i);
+    }
+    hashTable.reset_stats();
+
+    // Test case 1: Readers under a shared lock, as in ConcurrentHashTable
+    const int threads = 8;
+    const int perThread = 1000;
+    shared_mutex lock;
+    vector<thread> readers;
+    for (int t = 0; t < threads; ++t) {
+        readers.emplace_back([&hashTable, &lock]() {
+            for (int i = 0; i < perThread; ++i) {
+                shared_lock<shared_mutex> guard(lock);
+                assert(hashTable.get("key" + to_string(i % 100)) == i % 100);
+                assert(hashTable.has("missing") == false);
+            }
+        });
+    }
+    for (thread &reader : readers) {
+        reader.join();
+    }
+    const HashTableStats &stats = hashTable.stats();
+    assert(stats.lookups == size_t{2} * threads * perThread);
+    assert(stats.misses == size_t{threads} * perThread);
+    assert(stats.maxProbes >= 1);
+
+    // Test case 2: ConcurrentHashTable readers on one shard
+    ConcurrentHashTable<int> table(1);
+    table.set("shared", 7);
+    vector<thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&table]() {
+            for (int i = 0; i < perThread; ++i) {
+                assert(table.get("shared") == 7);
+                assert(table.has("absent") == false);
+            }
+        });
+    }
+    for (thread &worker : workers) {
+        worker.join();
+    }
+}
+#endif
+
+int main() {
+    runTests(); // Run the tests
+#ifdef HASH_TABLE_STATS
+    runStatsTests();
+#endif
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,304 @@
+#ifndef FLAT_HASH_TABLE_H
+#define FLAT_HASH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "hashFunctions.h" // Default hashers
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+// Open-addressing hash table in the style of SwissTable.
+//
+// Instead of a vector of pointers to linked Buckets, all entries live in one
+// flat slot array. Every slot has a one-byte control entry: either EMPTY,
+// DELETED, or the low 7 bits of the key's hash (H2). Control bytes are probed
+// a group of 16 at a time, so a lookup usually reads one control line and one
+// slot line, and only compares full keys whose H2 already matched.
+// Hash maps a key to a 64-bit hash (see hashFunctions.h).
+template <typename U, typename Hash = WyHash>
+class FlatHashTable {
+private:
+    static constexpr size_t GROUP_WIDTH = 16;     // Control bytes probed at once
+    static constexpr int8_t CTRL_EMPTY = -128;    // 0b10000000
+    static constexpr int8_t CTRL_DELETED = -2;    // 0b11111110
+
+    struct Slot {
+        string key;
+        U value;
+    };
+
+    // Bit mask of positions inside one group of control bytes
+    class Group {
+    private:
+        const int8_t *ctrl;
+
+    public:
+        explicit Group(const int8_t *ctrl) : ctrl{ctrl} {};
+
+        // Positions whose control byte equals h2
+        uint32_t match(int8_t h2) const;
+
+        // Positions that are EMPTY
+        uint32_t matchEmpty() const;
+
+        // Positions that are EMPTY or DELETED
+        uint32_t matchEmptyOrDeleted() const;
+    };
+
+    size_t capacity = 0;       // Number of slots, always a multiple of GROUP_WIDTH
+    size_t size = 0;           // Number of stored elements
+    size_t growthLeft = 0;     // Inserts allowed into EMPTY slots before resize
+    int8_t *ctrl = nullptr;    // Control bytes, one per slot
+    Slot *slots = nullptr;     // Raw slot storage, constructed only when full
+    Hash hasher;               // Hash function object
+
+    size_t hashKey(string_view key) const { return static_cast<size_t>(hasher(key)); }
+    static size_t h1(size_t hash) { return hash >> 7; }
+    static int8_t h2(size_t hash) { return static_cast<int8_t>(hash & 0x7F); }
+
+    // Largest number of elements the table may hold at a capacity (7/8 load)
+    static size_t maxLoad(size_t cap) { return cap - cap / 8; }
+
+    // Private method to find the slot holding key, or capacity if absent
+    size_t find(string_view key, size_t hash) const;
+
+    // Private method to find a free slot for a key known to be absent
+    size_t findInsertSlot(size_t hash) const;
+
+    void allocate(size_t newCapacity);
+    void release();
+    void resize(size_t newCapacity);
+
+public:
+    // Constructor to initialize the FlatHashTable
+    FlatHashTable() { allocate(128); };
+
+    // Constructor taking a configured (e.g. seeded) hasher
+    explicit FlatHashTable(const Hash &hasher) : hasher{hasher} { allocate(128); };
+
+    FlatHashTable(const FlatHashTable &) = delete;
+    FlatHashTable &operator=(const FlatHashTable &) = delete;
+
+    // Method to check if a key exists in the FlatHashTable
+    bool has(string_view key);
+
+    // Method to get the value associated with a key
+    U get(string_view key);
+
+    // Method to set a key-value pair in the FlatHashTable
+    void set(const string &key, const U &value);
+
+    // Method to remove a key-value pair from the FlatHashTable
+    bool remove(string_view key);
+
+    ~FlatHashTable() { release(); };
+};
+
+// Group matching: one SSE2 compare + movemask per 16 slots, scalar otherwise
+
+template <typename U, typename Hash>
+uint32_t FlatHashTable<U, Hash>::Group::match(int8_t h2) const {
+#ifdef __SSE2__
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), group)));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < GROUP_WIDTH; ++i) {
+        if (ctrl[i] == h2) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+template <typename U, typename Hash>
+uint32_t FlatHashTable<U, Hash>::Group::matchEmpty() const {
+    return match(CTRL_EMPTY);
+}
+
+template <typename U, typename Hash>
+uint32_t FlatHashTable<U, Hash>::Group::matchEmptyOrDeleted() const {
+#ifdef __SSE2__
+    // EMPTY and DELETED are the only control bytes with the sign bit set
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+    return static_cast<uint32_t>(_mm_movemask_epi8(group));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < GROUP_WIDTH; ++i) {
+        if (ctrl[i] < 0) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+// Definition of the allocate method
+template <typename U, typename Hash>
+void FlatHashTable<U, Hash>::allocate(size_t newCapacity) {
+    capacity = newCapacity;
+    ctrl = new int8_t[capacity];
+    memset(ctrl, CTRL_EMPTY, capacity);
+    slots = static_cast<Slot *>(::operator new(capacity * sizeof(Slot)));
+    size = 0;
+    growthLeft = maxLoad(capacity);
+}
+
+// Definition of the release method: destroy live slots and free the arrays
+template <typename U, typename Hash>
+void FlatHashTable<U, Hash>::release() {
+    for (size_t i = 0; i < capacity; ++i) {
+        if (ctrl[i] >= 0) {
+            slots[i].~Slot();
+        }
+    }
+    ::operator delete(slots);
+    delete[] ctrl;
+    slots = nullptr;
+    ctrl = nullptr;
+}
+
+// Definition of the find method
+template <typename U, typename Hash>
+size_t FlatHashTable<U, Hash>::find(string_view key, size_t hash) const {
+    size_t groupMask = capacity / GROUP_WIDTH - 1;
+    size_t group = h1(hash) & groupMask;
+    int8_t tag = h2(hash);
+
+    // Quadratic probing over whole groups; every group is visited once
+    for (size_t step = 1; ; ++step) {
+        size_t base = group * GROUP_WIDTH;
+        Group g(ctrl + base);
+
+        for (uint32_t m = g.match(tag); m != 0; m &= m - 1) {
+            size_t index = base + __builtin_ctz(m);
+            if (slots[index].key == key) {
+                return index;
+            }
+        }
+        // An EMPTY slot ends the probe sequence: the key was never placed past it
+        if (g.matchEmpty() != 0 || step > groupMask) {
+            return capacity;
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+// Definition of the findInsertSlot method
+template <typename U, typename Hash>
+size_t FlatHashTable<U, Hash>::findInsertSlot(size_t hash) const {
+    size_t groupMask = capacity / GROUP_WIDTH - 1;
+    size_t group = h1(hash) & groupMask;
+
+    for (size_t step = 1; ; ++step) {
+        size_t base = group * GROUP_WIDTH;
+        uint32_t m = Group(ctrl + base).matchEmptyOrDeleted();
+        if (m != 0) {
+            return base + __builtin_ctz(m);
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+// Definition of the resize method: move every live slot into fresh arrays
+template <typename U, typename Hash>
+void FlatHashTable<U, Hash>::resize(size_t newCapacity) {
+    int8_t *oldCtrl = ctrl;
+    Slot *oldSlots = slots;
+    size_t oldCapacity = capacity;
+    size_t oldSize = size;
+
+    allocate(newCapacity);
+
+    for (size_t i = 0; i < oldCapacity; ++i) {
+        if (oldCtrl[i] >= 0) {
+            size_t hash = hashKey(oldSlots[i].key);
+            size_t index = findInsertSlot(hash);
+            new (&slots[index]) Slot{std::move(oldSlots[i].key), std::move(oldSlots[i].value)};
+            ctrl[index] = h2(hash); // Marked full only once the Slot exists
+            oldSlots[i].~Slot();
+        }
+    }
+    size = oldSize;
+    growthLeft -= oldSize;
+
+    ::operator delete(oldSlots);
+    delete[] oldCtrl;
+}
+
+// Definition of the has method
+template <typename U, typename Hash>
+bool FlatHashTable<U, Hash>::has(string_view key) {
+    return find(key, hashKey(key)) != capacity;
+}
+
+// Definition of the get method
+template <typename U, typename Hash>
+U FlatHashTable<U, Hash>::get(string_view key) {
+    size_t index = find(key, hashKey(key));
+    if (index != capacity) {
+        return slots[index].value; // Return the value associated with the key
+    }
+    return U{}; // Return default value if key is not found
+}
+
+// Definition of the set method
+template <typename U, typename Hash>
+void FlatHashTable<U, Hash>::set(const string &key, const U &value) {
+    size_t hash = hashKey(key);
+    size_t index = find(key, hash);
+
+    if (index != capacity) {
+        slots[index].value = value; // Key already present, update in place
+        return;
+    }
+
+    if (growthLeft == 0) {
+        // Double when genuinely full, otherwise rehash in place to purge tombstones
+        resize(size * 2 >= maxLoad(capacity) ? capacity * 2 : capacity);
+    }
+
+    index = findInsertSlot(hash);
+    new (&slots[index]) Slot{key, value}; // If a copy throws, the slot stays free
+    if (ctrl[index] == CTRL_EMPTY) {
+        growthLeft--; // Reusing a tombstone does not consume growth budget
+    }
+    ctrl[index] = h2(hash);
+    size++;
+}
+
+// Definition of the remove method
+template <typename U, typename Hash>
+bool FlatHashTable<U, Hash>::remove(string_view key) {
+    size_t index = find(key, hashKey(key));
+    if (index == capacity) {
+        return false;
+    }
+
+    slots[index].~Slot();
+    size--;
+
+    // If the group still has an EMPTY slot no probe sequence can pass through
+    // this one, so it may become EMPTY again instead of a tombstone
+    size_t base = index & ~(GROUP_WIDTH - 1);
+    if (Group(ctrl + base).matchEmpty() != 0) {
+        ctrl[index] = CTRL_EMPTY;
+        growthLeft++;
+    } else {
+        ctrl[index] = CTRL_DELETED;
+    }
+    return true;
+}
+
+#endif // FLAT_HASH_TABLE_H
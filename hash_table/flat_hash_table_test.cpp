@@ -0,0 +1,90 @@
+#include <iostream>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include "flatHashTable.h"
+
+using namespace std;
+
+// Function to run tests for the FlatHashTable class
+// Value whose copy throws while failCopies is set
+struct Fragile {
+    static inline bool failCopies = false;
+    string payload;
+    Fragile() = default;
+    explicit Fragile(string payload) : payload{std::move(payload)} {}
+    Fragile(const Fragile &other) : payload{other.payload} {
+        if (failCopies) {
+            throw runtime_error("copy failed");
+        }
+    }
+    Fragile(Fragile &&) = default;
+    Fragile &operator=(const Fragile &) = default;
+};
+
+void runTests() {
+    // Test case 1: Insertion and retrieval
+    FlatHashTable<int> table;
+    table.set("key1", 10);
+    table.set("key2", 20);
+    table.set("key3", 30);
+    assert(table.get("key1") == 10);
+    assert(table.get("key2") == 20);
+    assert(table.get("key3") == 30);
+
+    // Test case 2: Updating existing value
+    table.set("key1", 50);
+    assert(table.get("key1") == 50);
+
+    // Test case 3: Removal
+    assert(table.remove("key2") == true);
+    assert(table.remove("key2") == false);
+    assert(table.get("key2") == 0); // Removed, should return default value (0)
+    assert(table.has("key1") == true);
+    assert(table.has("key2") == false);
+
+    // Test case 4: Growth past several resizes
+    for (int i = 0; i < 10000; ++i) {
+        table.set("key" + to_string(i), i * 10);
+    }
+    for (int i = 0; i < 10000; ++i) {
+        assert(table.get("key" + to_string(i)) == i * 10);
+    }
+
+    // Test case 5: Heavy churn leaves tombstones that must not break probing
+    for (int i = 0; i < 10000; i += 2) {
+        assert(table.remove("key" + to_string(i)) == true);
+    }
+    for (int round = 0; round < 5; ++round) {
+        for (int i = 0; i < 2000; ++i) {
+            table.set("churn" + to_string(i), i);
+        }
+        for (int i = 0; i < 2000; ++i) {
+            assert(table.remove("churn" + to_string(i)) == true);
+        }
+    }
+    for (int i = 0; i < 10000; ++i) {
+        assert(table.has("key" + to_string(i)) == (i % 2 == 1));
+    }
+
+    // Test case 6: A throwing value copy leaves no half-built slot behind
+    FlatHashTable<Fragile> fragile;
+    fragile.set("kept", Fragile("a string long enough to be heap allocated"));
+    Fragile::failCopies = true;
+    bool thrown = false;
+    try {
+        fragile.set("lost", Fragile("x"));
+    } catch (const runtime_error &) {
+        thrown = true;
+    }
+    Fragile::failCopies = false;
+    assert(thrown == true);
+    assert(fragile.has("lost") == false);
+    assert(fragile.get("kept").payload == "a string long enough to be heap allocated");
+}
+
+int main() {
+    runTests(); // Run the tests
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
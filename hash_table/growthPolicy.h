@@ -0,0 +1,66 @@
+#ifndef GROWTH_POLICY_H
+#define GROWTH_POLICY_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Growth policies for HashTable.
+//
+// A policy decides which bucket counts the table may use and how a 64-bit
+// hash is reduced to a bucket index for that count:
+//   roundUp(n)            smallest allowed bucket count >= n
+//   grow(buckets)         bucket count to move to when the table is full
+//   index(hash, buckets)  bucket of a hash, in [0, buckets)
+
+// Doubling power-of-two sizes; the index is a mask. Fastest lookups, but
+// memory jumps by 2x and a weak hash only contributes its low bits.
+struct PowerOfTwoGrowth {
+    static size_t roundUp(size_t n) {
+        size_t buckets = 1;
+        while (buckets < n) {
+            buckets <<= 1;
+        }
+        return buckets;
+    }
+
+    static size_t grow(size_t buckets) { return buckets * 2; }
+
+    static size_t index(uint64_t hash, size_t buckets) { return static_cast<size_t>(hash) & (buckets - 1); }
+};
+
+// 1.5x growth for tighter memory; any bucket count is allowed. The index uses
+// a multiply-shift range reduction (high half of hash * buckets), so there is
+// still no division on the lookup path.
+struct OneAndHalfGrowth {
+    static size_t roundUp(size_t n) { return n < 2 ? 2 : n; }
+
+    static size_t grow(size_t buckets) { return buckets + buckets / 2; }
+
+    static size_t index(uint64_t hash, size_t buckets) {
+        return static_cast<size_t>((static_cast<__uint128_t>(hash) * buckets) >> 64);
+    }
+};
+
+// Prime bucket counts, roughly doubling. The modulo costs a division but
+// uses every bit of the hash, which tolerates poor hash functions best.
+struct PrimeGrowth {
+    static size_t roundUp(size_t n) {
+        static constexpr size_t PRIMES[] = {
+            5ul, 11ul, 23ul, 53ul, 97ul, 193ul, 389ul, 769ul, 1543ul, 3079ul, 6151ul, 12289ul,
+            24593ul, 49157ul, 98317ul, 196613ul, 393241ul, 786433ul, 1572869ul, 3145739ul,
+            6291469ul, 12582917ul, 25165843ul, 50331653ul, 100663319ul, 201326611ul,
+            402653189ul, 805306457ul, 1610612741ul, 3221225473ul, 4294967291ul};
+        for (size_t prime : PRIMES) {
+            if (prime >= n) {
+                return prime;
+            }
+        }
+        return n | 1; // Beyond the table: odd sizes still avoid the worst patterns
+    }
+
+    static size_t grow(size_t buckets) { return roundUp(buckets * 2); }
+
+    static size_t index(uint64_t hash, size_t buckets) { return static_cast<size_t>(hash % buckets); }
+};
+
+#endif // GROWTH_POLICY_H
@@ -0,0 +1,266 @@
+#ifndef HASH_FUNCTIONS_H
+#define HASH_FUNCTIONS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Hashers usable as the Hash parameter of HashTable and FlatHashTable.
+//
+// Every hasher is a small copyable function object returning a full 64-bit
+// hash of a string_view. The tables reduce that value to a slot index
+// themselves, so a hasher only has to mix well across all 64 bits.
+// Each hasher takes an optional seed; tables built with different seeds
+// place the same keys differently, which defends against crafted collisions.
+
+namespace hash_detail {
+
+// Unaligned little-endian loads
+inline uint64_t read64(const unsigned char *p) {
+    uint64_t v;
+    std::memcpy(&v, p, 8);
+    return v;
+}
+
+inline uint64_t read32(const unsigned char *p) {
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
+}
+
+// 64x64 -> 128 bit multiply, returns both halves folded together
+inline uint64_t mulFold64(uint64_t a, uint64_t b) {
+    __uint128_t product = static_cast<__uint128_t>(a) * b;
+    return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+}
+
+} // namespace hash_detail
+
+// wyhash (final4 variant): very fast on short keys, passes SMHasher
+class WyHash {
+private:
+    static constexpr uint64_t SECRET[4] = {0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+                                           0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+    uint64_t seed;
+
+    static void mum(uint64_t &a, uint64_t &b) {
+        __uint128_t r = static_cast<__uint128_t>(a) * b;
+        a = static_cast<uint64_t>(r);
+        b = static_cast<uint64_t>(r >> 64);
+    }
+
+    static uint64_t mix(uint64_t a, uint64_t b) {
+        mum(a, b);
+        return a ^ b;
+    }
+
+public:
+    explicit WyHash(uint64_t seed = 0) : seed{seed} {};
+
+    uint64_t operator()(std::string_view key) const;
+};
+
+inline uint64_t WyHash::operator()(std::string_view key) const {
+    using hash_detail::read32;
+    using hash_detail::read64;
+
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(key.data());
+    size_t len = key.size();
+    uint64_t s = seed ^ mix(seed ^ SECRET[0], SECRET[1]);
+    uint64_t a, b;
+
+    if (len <= 16) {
+        if (len >= 4) {
+            // Two overlapping 4-byte reads from each end cover 4..16 bytes
+            a = (read32(p) << 32) | read32(p + ((len >> 3) << 2));
+            b = (read32(p + len - 4) << 32) | read32(p + len - 4 - ((len >> 3) << 2));
+        } else if (len > 0) {
+            a = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[len >> 1]) << 8) | p[len - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = len;
+        if (i > 48) {
+            // Three independent lanes keep the multiplier busy on long keys
+            uint64_t s1 = s, s2 = s;
+            do {
+                s = mix(read64(p) ^ SECRET[1], read64(p + 8) ^ s);
+                s1 = mix(read64(p + 16) ^ SECRET[2], read64(p + 24) ^ s1);
+                s2 = mix(read64(p + 32) ^ SECRET[3], read64(p + 40) ^ s2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            s ^= s1 ^ s2;
+        }
+        while (i > 16) {
+            s = mix(read64(p) ^ SECRET[1], read64(p + 8) ^ s);
+            i -= 16;
+            p += 16;
+        }
+        a = read64(p + i - 16);
+        b = read64(p + i - 8);
+    }
+
+    a ^= SECRET[1];
+    b ^= s;
+    mum(a, b);
+    return mix(a ^ SECRET[0] ^ len, b ^ SECRET[1]);
+}
+
+// XXH3-style hasher: the short-input paths and avalanche of XXH3-64 with
+// 16-byte stripes for longer keys. Not bit-compatible with the reference
+// implementation, which needs its 192-byte secret.
+class XxHash3 {
+private:
+    static constexpr uint64_t PRIME64_1 = 0x9E3779B185EBCA87ull;
+    static constexpr uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4Full;
+    static constexpr uint64_t KEY[4] = {0xbe4ba423396cfeb8ull, 0x1cad21f72c81017cull,
+                                        0xdb979083e96dd4deull, 0x1f67b3b7a4a44072ull};
+    uint64_t seed;
+
+    static uint64_t avalanche(uint64_t h) {
+        h ^= h >> 37;
+        h *= 0x165667919E3779F9ull;
+        h ^= h >> 32;
+        return h;
+    }
+
+public:
+    explicit XxHash3(uint64_t seed = 0) : seed{seed} {};
+
+    uint64_t operator()(std::string_view key) const;
+};
+
+inline uint64_t XxHash3::operator()(std::string_view key) const {
+    using hash_detail::mulFold64;
+    using hash_detail::read32;
+    using hash_detail::read64;
+
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(key.data());
+    size_t len = key.size();
+
+    if (len == 0) {
+        return avalanche(seed ^ KEY[0] ^ KEY[1]);
+    }
+    if (len <= 3) {
+        uint64_t combined = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[len >> 1]) << 24) |
+                            p[len - 1] | (static_cast<uint64_t>(len) << 8);
+        return avalanche(mulFold64(combined ^ (KEY[0] + seed), PRIME64_1));
+    }
+    if (len <= 8) {
+        uint64_t combined = read32(p + len - 4) | (read32(p) << 32);
+        return avalanche(mulFold64(combined ^ (KEY[1] - seed), PRIME64_2 + len));
+    }
+    if (len <= 16) {
+        uint64_t lo = read64(p) ^ (KEY[2] + seed);
+        uint64_t hi = read64(p + len - 8) ^ (KEY[3] - seed);
+        return avalanche(len + __builtin_bswap64(lo) + hi + mulFold64(lo, hi));
+    }
+
+    uint64_t acc = len * PRIME64_1;
+    size_t stripes = (len - 1) / 16;
+    for (size_t i = 0; i < stripes; ++i) {
+        const unsigned char *s = p + i * 16;
+        acc += mulFold64(read64(s) ^ (KEY[i & 3] + seed), read64(s + 8) ^ (KEY[(i + 1) & 3] - seed));
+    }
+    // The last 16 bytes always form a full (possibly overlapping) stripe
+    const unsigned char *last = p + len - 16;
+    acc += mulFold64(read64(last) ^ (KEY[3] + seed), read64(last + 8) ^ (KEY[0] - seed));
+    return avalanche(acc);
+}
+
+// Hasher for integer keys, including 128-bit IDs. One 64x64->128 bit
+// multiply (two for 128-bit keys) mixes every input bit into both halves, so
+// the low bits used for power-of-two masking are well distributed even for
+// sequential IDs.
+// Integers of every width hash by value: 5 and 5ull give the same hash, as
+// do -1 and (__int128)-1.
+class IntegerHash {
+private:
+    static constexpr uint64_t MUL_A = 0x2d358dccaa6c78a5ull;
+    static constexpr uint64_t MUL_B = 0x8bb84b93962eacc9ull;
+    uint64_t seed;
+
+public:
+    explicit IntegerHash(uint64_t seed = 0) : seed{seed} {};
+
+    template <typename I, typename = std::enable_if_t<std::is_integral_v<I> || std::is_enum_v<I>>>
+    uint64_t operator()(I key) const {
+        return hash_detail::mulFold64(static_cast<uint64_t>(key) ^ seed ^ MUL_A, MUL_B);
+    }
+
+    uint64_t operator()(unsigned __int128 key) const {
+        uint64_t lo = static_cast<uint64_t>(key);
+        uint64_t hi = static_cast<uint64_t>(key >> 64);
+        if (hi == 0) {
+            return (*this)(lo); // Same hash as the 64-bit value
+        }
+        return mixHalves(lo, hi);
+    }
+
+    uint64_t operator()(__int128 key) const {
+        uint64_t lo = static_cast<uint64_t>(key);
+        uint64_t hi = static_cast<uint64_t>(key >> 64);
+        if (hi == static_cast<uint64_t>(static_cast<int64_t>(lo) >> 63)) {
+            return (*this)(lo); // Fits in 64 bits, e.g. -1: same hash as the 64-bit value
+        }
+        return mixHalves(lo, hi);
+    }
+
+private:
+    // Mix the halves one after the other: multiplying lo by a function of
+    // hi would give 0 for every key whose hi makes that factor 0
+    uint64_t mixHalves(uint64_t lo, uint64_t hi) const {
+        uint64_t mixed = hash_detail::mulFold64(lo ^ seed ^ MUL_A, MUL_B);
+        return hash_detail::mulFold64(mixed ^ hi, MUL_A) ^ hi;
+    }
+};
+
+// Adapter for any other key with a std::hash specialization. Standard hashes
+// are often the identity for small types, so the result is mixed again.
+template <typename K>
+class StdHashMixer {
+public:
+    uint64_t operator()(const K &key) const { return IntegerHash()(static_cast<uint64_t>(std::hash<K>{}(key))); }
+};
+
+namespace hash_detail {
+
+template <typename K, typename = void>
+struct DefaultHashFor {
+    using type = StdHashMixer<K>;
+};
+
+template <typename K>
+struct DefaultHashFor<K, std::enable_if_t<std::is_integral_v<K> || std::is_enum_v<K>>> {
+    using type = IntegerHash;
+};
+
+template <>
+struct DefaultHashFor<unsigned __int128> {
+    using type = IntegerHash;
+};
+
+template <>
+struct DefaultHashFor<__int128> {
+    using type = IntegerHash;
+};
+
+template <>
+struct DefaultHashFor<std::string> {
+    using type = WyHash;
+};
+
+} // namespace hash_detail
+
+// Hasher a table uses for key type K unless told otherwise
+template <typename K>
+using DefaultHash = typename hash_detail::DefaultHashFor<K>::type;
+
+#endif // HASH_FUNCTIONS_H
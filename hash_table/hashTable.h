@@ -1,204 +1,1047 @@
 #ifndef HASH_TABLE_H
 #define HASH_TABLE_H
 
+#include <cstdint>
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
 #include "bucket.h" // Include the definition of the Bucket class
+#include "hashTableLinkedList.h" // Singly linked alternative to Bucket
+#include "bloomFilter.h" // Optional filter in front of lookups
+#include "hashFunctions.h" // Default hashers
+#include "growthPolicy.h" // Bucket count and index policies
+#include "hashTableStats.h" // Optional instrumentation (-DHASH_TABLE_STATS)
+#include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 using namespace std;
 
-// Template declaration for the HashTable class
-template <typename U>
-class HashTable {
+// Template declaration for the hash table with any key type K
+// Hash maps a key to a 64-bit hash (see hashFunctions.h)
+// KeyEqual compares a stored key with a lookup key
+// Alloc is rebound to allocate Nodes and Buckets (e.g. PoolAllocator<char>)
+// Growth picks bucket counts and maps hashes to buckets (see growthPolicy.h)
+// Chain is the per-Bucket list: Bucket (doubly linked) or HashTableLinkedList
+// (singly linked, one pointer less per entry; see hashTableLinkedList.h)
+template <typename K, typename U, typename Hash = DefaultHash<K>, typename KeyEqual = std::equal_to<>,
+          typename Alloc = std::allocator<char>, typename Growth = PowerOfTwoGrowth,
+          template <typename, typename, typename> class Chain = Bucket>
+class BasicHashTable {
 private:
-    size_t capacity = 100; // Default size of the hash table
-    int size = 0; // Current number of elements in the hash table
-    const float loadFactorThreshold = 0.75;
-    vector<Bucket<string, U>*> data; // Vector to store pointers to Buckets
+    // Lookups take string_view for string keys and the key itself otherwise
+    using KeyArg = conditional_t<is_same_v<K, string>, string_view, const K &>;
+    using LookupKey = conditional_t<is_same_v<K, string>, string_view, K>;
 
+    using NodeType = typename Chain<K, U, std::allocator<char>>::NodeType;
+    using NodeAlloc = typename allocator_traits<Alloc>::template rebind_alloc<NodeType>;
+    using BucketType = Chain<K, U, NodeAlloc>;
+    using BucketAlloc = typename allocator_traits<Alloc>::template rebind_alloc<BucketType>;
 
-    // Private method to calculate the hash value of a key
-    int hashFunction(const string &key, const size_t &hashSize);
-    void resize();
+    size_t capacity = Growth::roundUp(128); // Number of Buckets, as allowed by Growth
+    size_t length = 0; // Current number of elements in the hash table
+    float loadFactorThreshold = 0.75; // Largest length / capacity before growing
+    vector<BucketType*> data; // Vector to store pointers to Buckets
+    Hash hasher; // Hash function object
+    KeyEqual keyEqual; // Key comparison function object
+    NodeAlloc nodeAlloc; // Allocator handed to every Bucket
+    BucketAlloc bucketAlloc; // Allocator for the Buckets themselves
+
+    // Incremental rehash state: while oldData is non-empty, keys live either in
+    // their not yet migrated old Bucket or in data
+    bool incrementalRehash = false; // Migrate buckets gradually instead of in one pass
+    vector<BucketType*> oldData; // Buckets of the previous, smaller table
+    size_t oldCapacity = 0; // Size of oldData
+    size_t migrateIndex = 0; // Next old bucket to migrate
+    static constexpr size_t REHASH_STEP = 4; // Old buckets migrated per operation
+
+
+    // Private method to calculate the full 64-bit hash value of a key
+    uint64_t hashFunction(KeyArg key);
+
+    // Private method to map a hash to a Bucket index (a mask for the default policy)
+    static size_t indexFor(uint64_t hash, size_t hashSize) { return Growth::index(hash, hashSize); }
+    void resize(size_t newCapacity);
+
+    // Private method to find the capacity that holds n elements within the load factor
+    size_t capacityFor(size_t n) const;
+
+    // Private method to find the smallest allowed capacity that holds n elements
+    size_t smallestCapacityFor(size_t n) const;
+
+    // Private method to shrink after removals, if enabled
+    void tryShrink();
+
+    // Private method to find the first node at or after Bucket index of
+    // oldData (phase 0) or data (phase 1); updates both, nullptr at the end
+    NodeType* firstNodeFrom(int &phase, size_t &index) const;
+
+    template <typename It>
+    It beginAs() const {
+        int phase = 0;
+        size_t index = 0;
+        NodeType* node = firstNodeFrom(phase, index);
+        return It(this, phase, index, node);
+    }
+
+    bool shrinkOnDelete = false; // Give memory back when the table becomes sparse
+
+    // Optional Bloom filter over the hashes of all keys, so most lookups of
+    // absent keys are answered from one cache line without walking a chain
+    bool bloomEnabled = false;
+    BlockedBloomFilter bloom; // Covers the keys in data
+    BlockedBloomFilter oldBloom; // Covers the keys still in oldData while rehashing
+    size_t bloomStaleRemoves = 0; // Removals since the filter was last rebuilt
+
+    // Private method to refill the filters from the cached node hashes
+    void rebuildBloom();
+
+    // Private method to check a hash against the filter covering the Bucket
+    // that owns it; false means the key is certainly absent
+    bool bloomMayContain(uint64_t hash) const;
+    static constexpr size_t MIN_CAPACITY = 16; // Never shrink below this many Buckets
+
+    // Private method to look a key up in list, which may be nullptr
+    NodeType* findNode(BucketType* list, KeyArg key, uint64_t hash);
+
+#ifdef HASH_TABLE_STATS
+    HashTableStats counters; // Instrumentation, see hashTableStats.h
+#endif
+
+    // Private method to find a key whose hash is already known or insert it
+    // with a value constructed from args; returns the node and whether it is new
+    template <typename KeyA, typename... Args>
+    pair<NodeType*, bool> emplaceHashed(uint64_t hash, KeyA &&key, Args &&...args);
+
+    // Private method to insert or update a key whose hash is already known
+    template <typename KeyA, typename ValueA>
+    bool insertHashed(KeyA &&key, ValueA &&value, uint64_t hash);
+
+    static constexpr size_t BATCH_SIZE = 16; // Keys in flight per get_many stage
+    static constexpr size_t PREFETCH_DISTANCE = 8; // How far insert_bulk prefetches ahead
+
+    // Private methods for rehashing
+    void moveBucket(BucketType* bucket, vector<BucketType*> &target, size_t targetCapacity);
+    void migrateOldBucket(size_t index);
+    void rehashStep();
+    void finishRehash();
+
+    // Private methods to allocate/free a Bucket through bucketAlloc
+    BucketType* newBucket();
+    void deleteBucket(BucketType* bucket);
+
+    // Private method to find the Bucket slot that currently owns a key's hash
+    BucketType* &bucketFor(uint64_t hash);
+
+    // Private variants of has, get and remove for a key whose hash is
+    // already known; hash must be exactly hasher(key) or the key is looked
+    // up in the wrong Bucket
+    bool hasHashed(KeyArg key, uint64_t hash);
+    U getHashed(KeyArg key, uint64_t hash);
+    bool removeHashed(KeyArg key, uint64_t hash);
+
+    // ConcurrentHashTable hashes each key once to pick a shard, then passes
+    // that hash to the shard's table through the hashed entry points
+    template <typename, typename>
+    friend class ConcurrentHashTable;
 
 public:
-    // Constructor to initialize the HashTable
-    HashTable() : data(capacity, nullptr) {};
+    /**
+     * Forward iterator over the key-value pairs, in Bucket order.
+     * Dereferencing yields pair<const K&, U&> (const U& for
+     * const_iterator), so `for (auto [key, value] : table)` can update
+     * values in place. Any other call on the table (including has/get while
+     * an incremental resize is in progress) invalidates iterators.
+     */
+    template <bool IsConst>
+    class Iterator {
+    private:
+        const BasicHashTable *table = nullptr;
+        int phase = 0;
+        size_t index = 0;
+        NodeType* node = nullptr;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = pair<const K, U>;
+        using reference = pair<const K &, conditional_t<IsConst, const U &, U &>>;
+        using pointer = void;
+        using difference_type = ptrdiff_t;
+
+        // A default-constructed iterator is singular: it equals only other
+        // default-constructed iterators
+        Iterator() = default;
+        Iterator(const BasicHashTable *table, int phase, size_t index, NodeType* node)
+            : table{table}, phase{phase}, index{index}, node{node} {}
+        reference operator*() const { return {node->key, node->value}; }
+        // Method to get the hash cached for the current key, i.e. hash_function()(key)
+        uint64_t hash() const { return node->hash; }
+        Iterator& operator++() {
+            node = node->next;
+            if (node == nullptr) {
+                ++index;
+                node = table->firstNodeFrom(phase, index); // Next non-empty Bucket
+            }
+            return *this;
+        }
+        Iterator operator++(int) { Iterator tmp = *this; ++*this; return tmp; }
+        bool operator==(const Iterator& other) const { return node == other.node; }
+        bool operator!=(const Iterator& other) const { return node != other.node; }
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    // Iterator support for range-based for loops
+    iterator begin() { return beginAs<iterator>(); }
+    iterator end() { return iterator(this, 2, 0, nullptr); }
+    const_iterator begin() const { return beginAs<const_iterator>(); }
+    const_iterator end() const { return const_iterator(this, 2, 0, nullptr); }
+
+    // Method to call fn(const K &key, U &value) for every pair. Walks the
+    // Bucket vectors front to back and prefetches a few Buckets ahead, which
+    // is cheaper than going through iterators.
+    template <typename Function>
+    void for_each(Function fn);
+
+    // Constructor to initialize the HashTable. Every constructor builds one
+    // Alloc for both Nodes and Buckets, so e.g. a PoolAllocator gives the
+    // table a single SlabPool
+    BasicHashTable() : BasicHashTable(Hash(), KeyEqual(), Alloc()) {};
+
+    // Constructor taking a configured (e.g. seeded) hasher
+    explicit BasicHashTable(const Hash &hasher) : BasicHashTable(hasher, KeyEqual(), Alloc()) {};
+
+    // Constructor taking a hasher and an allocator (copies share its state)
+    BasicHashTable(const Hash &hasher, const Alloc &alloc) : BasicHashTable(hasher, KeyEqual(), alloc) {};
+
+    // Constructor taking a hasher, a key comparison and an allocator
+    BasicHashTable(const Hash &hasher, const KeyEqual &keyEqual, const Alloc &alloc)
+        : data(capacity, nullptr), hasher{hasher}, keyEqual{keyEqual}, nodeAlloc{alloc}, bucketAlloc{alloc} {};
+
+    BasicHashTable(const BasicHashTable &) = delete;
+    BasicHashTable &operator=(const BasicHashTable &) = delete;
+
+    // For string keys lookups take string_view, so callers holding a char*
+    // or a slice of a parsed buffer never build a temporary std::string
 
     // Method to check if a key exists in the HashTable
-    bool has(const string &key);
+    bool has(KeyArg key);
 
     // Method to get the value associated with a key
-    U get(const string &key);
+    U get(KeyArg key);
 
     // Method to set a key-value pair in the HashTable
-    void set(const string &key, const U &value);
+    void set(const K &key, const U &value);
+
+    // Method to set a key-value pair, moving both into the table
+    void set(K &&key, U &&value);
+
+    // Method to insert a value constructed in place from args unless the key
+    // already exists; then nothing (not even args) is touched.
+    // Returns true if the pair was inserted.
+    template <typename KeyA, typename... Args>
+    bool try_emplace(KeyA &&key, Args &&...args);
+
+    // Method to insert or overwrite, forwarding key and value so rvalues are
+    // moved. Returns true if the pair was inserted, false if it was assigned.
+    template <typename KeyA, typename ValueA>
+    bool insert_or_assign(KeyA &&key, ValueA &&value);
+
+    // Method to get a reference to the value of key, inserting U{} first if
+    // the key is absent. Hashes and walks the chain once; the reference stays
+    // valid until the key is removed (resizes move Buckets, not nodes).
+    template <typename KeyA>
+    U &get_or_insert(KeyA &&key);
+
+    // Method to apply fn(U &value) to the value of key, inserting U{} first
+    // if the key is absent, e.g. update(word, [](int &n) { n++; }).
+    // Hashes and walks the chain once. Returns true if the key was inserted.
+    template <typename KeyA, typename Function>
+    bool update(KeyA &&key, Function fn);
 
     // Method to remove a key-value pair from the HashTable
-    bool remove(const string &key);
+    bool remove(KeyArg key);
+
+    // Method to grow the table once so that n entries fit without a resize
+    void reserve(size_t n);
+
+    // Method to insert a range of (key, value) pairs, e.g. a vector<pair<string, U>>.
+    // Pre-sizes once, hashes every key in a separate pass and prefetches the
+    // target Buckets a few entries ahead of the insert loop. The range is read
+    // twice, so it must be a forward range (not e.g. an istream range).
+    template <typename Range>
+    void insert_bulk(const Range &entries);
+
+    // Method to look up many keys at once, writing one value per key to out
+    // (U{} for missing keys). Keys are processed in batches whose hashing and
+    // memory accesses are staged so that cache misses overlap. Keys the range
+    // yields as K by value are copied while their batch is in flight; views
+    // such as string_view are not.
+    template <typename KeyRange, typename OutputIt>
+    OutputIt get_many(const KeyRange &keys, OutputIt out);
+
+    // Method to switch between stop-the-world and incremental resizing.
+    // In incremental mode a resize only allocates the new bucket array; each
+    // later has/get/set/remove migrates at most REHASH_STEP old buckets.
+    void set_incremental_rehash(bool enabled);
+
+    // Method to check if an incremental resize is still in progress
+    bool rehashing() const { return !oldData.empty(); }
+
+    // Method to get the number of key-value pairs
+    size_t get_length() const { return length; }
+
+    // Method to get the number of Buckets
+    size_t bucket_count() const { return capacity; }
+
+    // Method to get a copy of the hasher, e.g. to hash keys the same way elsewhere
+    Hash hash_function() const { return hasher; }
+
+    // Method to get the average number of elements per Bucket
+    float load_factor() const { return static_cast<float>(length) / capacity; }
+
+    // Method to get the load factor at which the table grows
+    float max_load_factor() const { return loadFactorThreshold; }
+
+    // Method to set the load factor at which the table grows. Lower values
+    // trade memory for shorter chains; grows immediately if already exceeded.
+    // Throws std::invalid_argument unless maxLoad > 0.
+    void max_load_factor(float maxLoad);
+
+    // Method to opt into shrinking on remove. When the load factor falls to a
+    // quarter of max_load_factor the table is rehashed to half that density,
+    // leaving headroom so alternating set/remove cannot thrash.
+    void set_shrink_on_delete(bool enabled) { shrinkOnDelete = enabled; }
+
+    // Method to opt into a blocked Bloom filter checked by has, get and
+    // get_many before the Bucket. Every resize starts a filter sized for the
+    // new capacity and fills it as nodes move (an incremental resize keeps
+    // the old filter for keys not moved yet). It is rebuilt after
+    // capacity / 4 removals because removed keys cannot be cleared from it.
+    // Costs about 10 bits per key of capacity plus one filter update per insert.
+    void set_bloom_filter(bool enabled);
 
-    ~HashTable();
+    // Method to rehash into the smallest table that holds the current
+    // elements, e.g. after a large eviction wave
+    void compact();
+
+#ifdef HASH_TABLE_STATS
+    // Method to get the counters collected so far
+    const HashTableStats &stats() const { return counters; }
+
+    // Method to zero the counters, e.g. at the start of a measurement window
+    void reset_stats() { counters.reset(); }
+
+    // Method to count Buckets by chain length: result[n] is the number of
+    // Buckets (empty ones included) holding n entries
+    vector<size_t> chain_length_histogram() const;
+
+    // Method to print the counters and the chain length histogram
+    void dump_stats(ostream &out = cout) const;
+#endif
+
+    ~BasicHashTable();
 
 
 };
 
 // Definition of the hashFunction method
-template <typename U>
-int HashTable<U>::hashFunction(const string &key, const  size_t &hashSize) {
-    int hash = 0;
-    // Simple hashing algorithm
-    for (char ch : key) {
-        hash = (hash * 31) + ch;
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+uint64_t BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::hashFunction(KeyArg key) {
+    return static_cast<uint64_t>(hasher(key));
+}
+
+// Definition of the bucketFor method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+typename BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::BucketType* &BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::bucketFor(uint64_t hash) {
+    if (rehashing()) {
+        // A key stays in its old Bucket until that Bucket is migrated
+        size_t oldIndex = indexFor(hash, oldCapacity);
+        if (oldData[oldIndex] != nullptr) {
+            return oldData[oldIndex];
+        }
     }
-      
-    return std::abs(static_cast<long long>(hash)) % hashSize; // Ensure hash value is within the bounds of the hash table size
+    return data[indexFor(hash, capacity)];
 }
 
 // Definition of the has method
-template <typename U>
-bool HashTable<U>::has(const string &key) {
-    int hash = hashFunction(key, capacity); // Calculate the hash value of the key
-   
-    Bucket<string, U>* list = data[hash]; // Get the Bucket at the calculated hash index
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+bool BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::has(KeyArg key) {
+    return hasHashed(key, hashFunction(key)); // Calculate the hash value of the key
+}
+
+// Definition of the hasHashed method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+bool BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::hasHashed(KeyArg key, uint64_t hash) {
+    rehashStep(); // Advance an in-progress incremental resize
+
+    if (bloomEnabled && !bloomMayContain(hash)) {
+        HASH_TABLE_STAT(counters.recordLookup(0, false));
+        return false; // Key certainly does not exist, no Bucket touched
+    }
+    BucketType* list = bucketFor(hash); // Get the Bucket that owns the key
 
     // Check if the Bucket exists and if the key exists in the Bucket
-    if (list != nullptr && list->get(key) != nullptr) {
+    if (findNode(list, key, hash) != nullptr) {
         return true; // Key exists
     }
     return false; // Key does not exist
 }
 
 // Definition of the get method
-template <typename U>
-U HashTable<U>::get(const string &key) {
-    int hash = hashFunction(key, capacity); // Calculate the hash value of the key
-    
-    Bucket<string, U>* list = data[hash]; // Get the Bucket at the calculated hash index
-    
-   
-    if (list != nullptr) {
-        
-        Node<string, U>* node = list->get(key); // Get the Node containing the key-value pair
-        if (node != nullptr) {
-            return node->value; // Return the value associated with the key
-        }
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+U BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::get(KeyArg key) {
+    return getHashed(key, hashFunction(key)); // Calculate the hash value of the key
+}
+
+// Definition of the getHashed method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+U BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::getHashed(KeyArg key, uint64_t hash) {
+    rehashStep(); // Advance an in-progress incremental resize
+
+    if (bloomEnabled && !bloomMayContain(hash)) {
+        HASH_TABLE_STAT(counters.recordLookup(0, false));
+        return U{}; // Key certainly does not exist, no Bucket touched
+    }
+    BucketType* list = bucketFor(hash); // Get the Bucket that owns the key
+
+    NodeType* node = findNode(list, key, hash); // Get the Node containing the key-value pair
+    if (node != nullptr) {
+        return node->value; // Return the value associated with the key
     }
     return U{}; // Return default value if key is not found
 }
 
+// Definition of the findNode method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+typename BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::NodeType* BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::findNode(BucketType* list, KeyArg key, uint64_t hash) {
+#ifdef HASH_TABLE_STATS
+    size_t probes = 0;
+    NodeType* node = list != nullptr ? list->get(key, hash, keyEqual, probes) : nullptr;
+    counters.recordLookup(probes, node != nullptr);
+    return node;
+#else
+    return list != nullptr ? list->get(key, hash, keyEqual) : nullptr;
+#endif
+}
+
 // Definition of the set method
-template <typename U>
-void HashTable<U>::set(const string &key, const U &value) {
-    int hash = hashFunction(key, capacity); // Calculate the hash value of the key
-   
-    Bucket<string, U>* &list = data[hash]; // Get the Bucket at the calculated hash index
-      
-    if (list == nullptr) {
-         // If Bucket does not exist, create a new Bucket and add key-value pair
-        list = new Bucket<string, U>();
-        size++;
-       
-    } 
-    list->push(key, value); // Add key-value pair to the Bucket
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::set(const K &key, const U &value) {
+    insertHashed(key, value, hashFunction(key)); // Calculate the hash value of the key and insert
+}
+
+// Definition of the moving set method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::set(K &&key, U &&value) {
+    uint64_t hash = hashFunction(key); // Hash before the key is moved from
+    insertHashed(std::move(key), std::move(value), hash);
+}
+
+// Definition of the try_emplace method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+template <typename KeyA, typename... Args>
+bool BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::try_emplace(KeyA &&key, Args &&...args) {
+    uint64_t hash = hashFunction(key);
+    return emplaceHashed(hash, std::forward<KeyA>(key), std::forward<Args>(args)...).second;
+}
 
-    if(size >= static_cast<int>(capacity * loadFactorThreshold)) {
-        resize(); // Resize the hash table if load factor exceeds the threshold
+// Definition of the insert_or_assign method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+template <typename KeyA, typename ValueA>
+bool BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::insert_or_assign(KeyA &&key, ValueA &&value) {
+    uint64_t hash = hashFunction(key);
+    return insertHashed(std::forward<KeyA>(key), std::forward<ValueA>(value), hash);
+}
+
+// Definition of the get_or_insert method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+template <typename KeyA>
+U &BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::get_or_insert(KeyA &&key) {
+    uint64_t hash = hashFunction(key);
+    return emplaceHashed(hash, std::forward<KeyA>(key)).first->value;
+}
+
+// Definition of the update method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+template <typename KeyA, typename Function>
+bool BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::update(KeyA &&key, Function fn) {
+    uint64_t hash = hashFunction(key);
+    pair<NodeType*, bool> result = emplaceHashed(hash, std::forward<KeyA>(key));
+    fn(result.first->value);
+    return result.second;
+}
+
+// Definition of the insertHashed method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+template <typename KeyA, typename ValueA>
+bool BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::insertHashed(KeyA &&key, ValueA &&value, uint64_t hash) {
+    // value is only consumed when emplaceHashed creates a node
+    pair<NodeType*, bool> result = emplaceHashed(hash, std::forward<KeyA>(key), std::forward<ValueA>(value));
+    if (!result.second) {
+        result.first->value = std::forward<ValueA>(value); // Key already present, update in place
+    }
+    return result.second;
+}
+
+// Definition of the emplaceHashed method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+template <typename KeyA, typename... Args>
+pair<typename BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::NodeType*, bool>
+BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::emplaceHashed(uint64_t hash, KeyA &&key, Args &&...args) {
+    rehashStep(); // Advance an in-progress incremental resize
+
+    if (rehashing()) {
+        // New entries only go into the new table, so migrate the key's old Bucket first
+        size_t oldIndex = indexFor(hash, oldCapacity);
+        if (oldData[oldIndex] != nullptr) {
+            migrateOldBucket(oldIndex);
+        }
     }
 
-   
+    BucketType* &list = data[indexFor(hash, capacity)]; // Get the Bucket at the calculated index
+
+    if (list == nullptr) {
+        // If Bucket does not exist, create a new Bucket and add key-value pair
+        list = newBucket();
+    }
+    pair<NodeType*, bool> result = list->try_emplace(std::forward<KeyA>(key), hash, keyEqual, std::forward<Args>(args)...);
+    HASH_TABLE_STAT(result.second ? counters.inserts++ : counters.updates++);
+    if (result.second) {
+        length++; // Count entries, not Buckets, so chain length is what is bounded
+        if (bloomEnabled) {
+            bloom.insert(hash);
+        }
+        if (length > capacity * loadFactorThreshold) {
+            // Resizing splices nodes between Buckets, so result.first stays valid
+            resize(capacityFor(length)); // Resize the hash table if load factor exceeds the threshold
+        }
+    }
+    return result;
 }
 
 // Definition of the remove method
-template <typename U>
-bool HashTable<U>::remove(const string &key) {
-    int hash = hashFunction(key, capacity); // Calculate the hash value of the key
- 
-
-    Bucket<string, U>* list = data[hash]; // Get the Bucket at the calculated hash index
-  
-    
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+bool BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::remove(KeyArg key) {
+    return removeHashed(key, hashFunction(key)); // Calculate the hash value of the key
+}
+
+// Definition of the removeHashed method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+bool BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::removeHashed(KeyArg key, uint64_t hash) {
+    rehashStep(); // Advance an in-progress incremental resize
+
+    BucketType* &list = bucketFor(hash); // Get the Bucket that owns the key
+
     if (list != nullptr) {
-        bool isDeleted = list->remove(key); // Remove the key-value pair from the Bucket
+        bool isDeleted = list->remove(key, hash, keyEqual); // Remove the key-value pair from the Bucket
+        if (isDeleted) {
+            length--;
+            HASH_TABLE_STAT(counters.removes++);
+            if (bloomEnabled && ++bloomStaleRemoves > capacity / 4) {
+                rebuildBloom(); // Drop the bits of removed keys, amortized O(1)
+            }
+        }
         if (list->empty()) {
-            data[hash] = nullptr;
-            delete list; // Delete the Bucket if it becomes empty after removal
+            deleteBucket(list); // Delete the Bucket if it becomes empty after removal
+            list = nullptr;
+        }
+        if (isDeleted) {
+            tryShrink(); // Runs after the Bucket is gone: shrinking rehashes every node
         }
         return isDeleted; // Return true if removal was successful, false otherwise
     }
     return false; // Return false if Bucket does not exist
 }
 
+// Definition of the moveBucket method: relink every node of bucket into target.
+// Nodes are spliced, not copied, so keys and values are never duplicated and
+// no Node is allocated or hashed while growing.
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::moveBucket(BucketType* bucket, vector<BucketType*> &target, size_t targetCapacity) {
+    // Detach nodes from the front of the old Bucket one at a time
+    while (NodeType* currentNode = bucket->unlinkHead()) {
+        // The node caches its full hash, so growing never re-hashes a key
+        size_t index = indexFor(currentNode->hash, targetCapacity);
+
+        // Get the Bucket at the new index
+        BucketType* &newBucket = target[index];
+
+        // If the Bucket is null, create a new Bucket
+        if (newBucket == nullptr) {
+            newBucket = this->newBucket();
+        }
+
+        // Keys are unique within the table, so the node can be linked without a lookup
+        newBucket->link(currentNode);
+
+        if (bloomEnabled) {
+            bloom.insert(currentNode->hash); // Fill the new filter as nodes arrive
+        }
+    }
+    deleteBucket(bucket);
+}
+
+// Definition of the newBucket method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+typename BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::BucketType* BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::newBucket() {
+    BucketType* bucket = allocator_traits<BucketAlloc>::allocate(bucketAlloc, 1);
+    allocator_traits<BucketAlloc>::construct(bucketAlloc, bucket, nodeAlloc);
+    return bucket;
+}
+
+// Definition of the deleteBucket method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::deleteBucket(BucketType* bucket) {
+    if (bucket != nullptr) {
+        allocator_traits<BucketAlloc>::destroy(bucketAlloc, bucket);
+        allocator_traits<BucketAlloc>::deallocate(bucketAlloc, bucket, 1);
+    }
+}
+
 // Definition of the resize method
-template <typename U>
-void HashTable<U>::resize() {
-  
-    // Calculate the new capacity as double the current capacity
-    size_t newCapacity = capacity * 2;
-    
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::resize(size_t newCapacity) {
+    HASH_TABLE_STAT(ResizeTimer timer(counters)); // Times only the setup of an incremental resize
+
+    // Only one incremental resize may be in flight; drain the previous one
+    finishRehash();
+
+    if (bloomEnabled) {
+        // Start a filter sized for the new capacity, filled as nodes move over.
+        // The old one keeps answering for keys an incremental resize has not
+        // moved yet, so no resize makes a separate pass over every node
+        swap(oldBloom, bloom);
+        bloom.reset(max(length, static_cast<size_t>(newCapacity * loadFactorThreshold)));
+        bloomStaleRemoves = 0;
+    }
+
     // Create a new vector to store pointers to Buckets with the new capacity
-    vector<Bucket<string, U>*> newData(newCapacity, nullptr);
-    
-    // Iterate through the current data vector
-    for (size_t i = 0; i < capacity; ++i) {
-        // Get the Bucket at index i
-        Bucket<string, U>* bucket = data[i];
-        
-        // Check if the Bucket is not null
-        if (bucket != nullptr) {
-            // Get the head of the Bucket's linked list
-            Node<string, U>* currentNode = bucket->head;
-            
-            // Iterate through the linked list
-            while (currentNode != nullptr) {
-                // Calculate the new hash for the current key using the new capacity
-                int hash = hashFunction(currentNode->key, newCapacity);
-                
-                // Ensure the hash is within the bounds of the new capacity
-                if (hash < newCapacity) { // Boundary check
-                    // Get the Bucket at the new hash index
-                    Bucket<string, U>* newBucket = newData[hash];
-                    
-                    // If the Bucket is null, create a new Bucket
-                    if (newBucket == nullptr) {
-                        newBucket = new Bucket<string, U>();
-                        newData[hash] = newBucket;
-                    }
-                    
-                    // Push the key-value pair to the new Bucket
-                    newBucket->push(currentNode->key, currentNode->value);
-                }
-                
-                // Move to the next node in the linked list
-                currentNode = currentNode->next;
+    vector<BucketType*> newData(newCapacity, nullptr);
+
+    if (incrementalRehash) {
+        // Keep the old Buckets side by side; rehashStep migrates them over time
+        oldData.swap(data);
+        oldCapacity = capacity;
+        migrateIndex = 0;
+        data.swap(newData);
+        capacity = newCapacity;
+    } else {
+        // Move the entries of every Bucket into the new data vector
+        for (size_t i = 0; i < capacity; ++i) {
+            if (data[i] != nullptr) {
+                moveBucket(data[i], newData, newCapacity);
             }
         }
+
+        // Update the capacity and the data vector to point to the new data
+        capacity = newCapacity;
+        data.swap(newData);
+
+        if (bloomEnabled) {
+            oldBloom.reset(0); // Every node is in the new filter already
+        }
     }
-    
-    // Update the capacity to the new capacity
-    capacity = newCapacity;
+}
 
-    // Deallocate memory from the old data vector
-    for (size_t i = 0; i < capacity / 2; ++i) {
-        delete data[i];
+// Definition of the set_bloom_filter method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::set_bloom_filter(bool enabled) {
+    bloomEnabled = enabled;
+    if (enabled) {
+        rebuildBloom();
+    } else {
+        bloom.reset(0); // Give the filters' memory back
+        oldBloom.reset(0);
     }
+}
 
-    // Update the data vector to point to the new data
-    data = newData;
+// Definition of the rebuildBloom method: no key is rehashed, nodes cache their hash
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::rebuildBloom() {
+    auto fill = [](BlockedBloomFilter &filter, const vector<BucketType*> &buckets) {
+        for (BucketType* bucket : buckets) {
+            for (NodeType* node = bucket != nullptr ? bucket->head : nullptr; node != nullptr; node = node->next) {
+                filter.insert(node->hash);
+            }
+        }
+    };
+    bloom.reset(max(length, static_cast<size_t>(capacity * loadFactorThreshold)));
+    oldBloom.reset(static_cast<size_t>(oldCapacity * loadFactorThreshold)); // Empty unless rehashing
+    fill(oldBloom, oldData);
+    fill(bloom, data);
+    bloomStaleRemoves = 0;
 }
 
-template < typename U>
-HashTable<U>::~HashTable() {
-     for (size_t i = 0; i < capacity / 2; ++i) {
-        delete data[i];
+// Definition of the bloomMayContain method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+bool BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::bloomMayContain(uint64_t hash) const {
+    // Same choice as bucketFor: a key stays in its old Bucket until that
+    // Bucket is migrated, and only then enters the new filter
+    if (rehashing() && oldData[indexFor(hash, oldCapacity)] != nullptr) {
+        return oldBloom.may_contain(hash);
     }
+    return bloom.may_contain(hash);
+}
 
+// Definition of the capacityFor method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+size_t BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::capacityFor(size_t n) const {
+    size_t newCapacity = capacity;
+    while (n > newCapacity * loadFactorThreshold) {
+        newCapacity = Growth::grow(newCapacity);
+    }
+    return newCapacity;
+}
 
+// Definition of the smallestCapacityFor method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+size_t BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::smallestCapacityFor(size_t n) const {
+    size_t newCapacity = Growth::roundUp(MIN_CAPACITY);
+    while (n > newCapacity * loadFactorThreshold) {
+        newCapacity = Growth::grow(newCapacity);
+    }
+    return newCapacity;
 }
 
-#endif // HASH_TABLE_H
+// Definition of the tryShrink method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::tryShrink() {
+    // Shrink when the table is 1/4 as dense as allowed to avoid thrashing
+    if (!shrinkOnDelete || length > capacity * loadFactorThreshold / 4) {
+        return;
+    }
+    size_t newCapacity = smallestCapacityFor(length * 2);
+    if (newCapacity < capacity) {
+        resize(newCapacity); // Incremental when that mode is on, like growing
+    }
+}
+
+// Definition of the compact method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::compact() {
+    size_t newCapacity = smallestCapacityFor(length);
+    if (newCapacity < capacity) {
+        resize(newCapacity);
+    }
+    finishRehash(); // An explicit compaction is never spread over later calls
+}
+
+// Definition of the max_load_factor method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::max_load_factor(float maxLoad) {
+    if (!(maxLoad > 0)) {
+        throw std::invalid_argument("max_load_factor must be positive");
+    }
+    loadFactorThreshold = maxLoad;
+    if (length > capacity * loadFactorThreshold) {
+        resize(capacityFor(length));
+    }
+}
 
+// Definition of the reserve method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::reserve(size_t n) {
+    size_t newCapacity = capacityFor(n);
+    if (newCapacity > capacity) {
+        resize(newCapacity);
+        finishRehash(); // An explicit reserve is never spread over later calls
+    }
+}
+
+// Definition of the insert_bulk method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+template <typename Range>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::insert_bulk(const Range &entries) {
+    using EntryIterator = decltype(std::begin(entries));
+    static_assert(is_base_of_v<forward_iterator_tag, typename iterator_traits<EntryIterator>::iterator_category>,
+                  "insert_bulk reads the range twice and needs forward iterators");
 
+    // Pass 1: hash every key; no table memory is touched yet
+    vector<uint64_t> hashes;
+    for (const auto &entry : entries) {
+        hashes.push_back(hashFunction(entry.first));
+    }
 
+    // Pre-size so that the insert loop below never resizes
+    reserve(length + hashes.size());
 
+    // Pass 2: insert, prefetching the Bucket slot PREFETCH_DISTANCE entries ahead
+    // and the Bucket itself half as far ahead, once its pointer is likely cached
+    size_t i = 0;
+    for (const auto &entry : entries) {
+        if (i + PREFETCH_DISTANCE < hashes.size()) {
+            __builtin_prefetch(&data[indexFor(hashes[i + PREFETCH_DISTANCE], capacity)]);
+        }
+        if (i + PREFETCH_DISTANCE / 2 < hashes.size()) {
+            BucketType* ahead = data[indexFor(hashes[i + PREFETCH_DISTANCE / 2], capacity)];
+            if (ahead != nullptr) {
+                __builtin_prefetch(ahead);
+            }
+        }
+        insertHashed(entry.first, entry.second, hashes[i]);
+        i++;
+    }
+}
+
+// Definition of the get_many method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+template <typename KeyRange, typename OutputIt>
+OutputIt BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::get_many(const KeyRange &keys, OutputIt out) {
+    rehashStep(); // Advance an in-progress incremental resize once per batch call
+
+    // A view into a key is only safe while the key outlives the batch: a K
+    // the range yields by value (e.g. a transform view) owns its data and is
+    // copied instead. References and non-owning values such as string_view
+    // or const char* are staged as views
+    using RangeRef = decltype(*std::begin(keys));
+    using StagedKey = conditional_t<!is_reference_v<RangeRef> && is_same_v<remove_cv_t<RangeRef>, K>, K, LookupKey>;
+
+    StagedKey batch[BATCH_SIZE];
+    uint64_t hashes[BATCH_SIZE];
+    BucketType* buckets[BATCH_SIZE];
+    size_t count = 0;
+
+    // Each stage touches one level of the structure for the whole batch, so
+    // its cache misses are in flight together instead of one after another
+    auto flush = [&]() {
+        for (size_t i = 0; i < count; ++i) {
+            // The filter answers most absent keys without touching their
+            // Bucket. Slots and filter blocks were prefetched while hashing
+            buckets[i] = bloomEnabled && !bloomMayContain(hashes[i]) ? nullptr : bucketFor(hashes[i]);
+            if (buckets[i] != nullptr) {
+                __builtin_prefetch(buckets[i]);
+            }
+        }
+        for (size_t i = 0; i < count; ++i) {
+            if (buckets[i] != nullptr && buckets[i]->head != nullptr) {
+                __builtin_prefetch(buckets[i]->head);
+            }
+        }
+        for (size_t i = 0; i < count; ++i) {
+            NodeType* node = findNode(buckets[i], batch[i], hashes[i]);
+            *out++ = node != nullptr ? node->value : U{};
+        }
+        count = 0;
+    };
+
+    for (const auto &key : keys) {
+        batch[count] = key;
+        hashes[count] = hashFunction(batch[count]);
+        __builtin_prefetch(&data[indexFor(hashes[count], capacity)]);
+        if (bloomEnabled) {
+            bloom.prefetch(hashes[count]);
+        }
+        if (++count == BATCH_SIZE) {
+            flush();
+        }
+    }
+    flush();
+    return out;
+}
+
+// Definition of the firstNodeFrom method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+typename BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::NodeType* BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::firstNodeFrom(int &phase, size_t &index) const {
+    for (; phase < 2; ++phase, index = 0) {
+        const vector<BucketType*> &buckets = phase == 0 ? oldData : data;
+        for (; index < buckets.size(); ++index) {
+            if (buckets[index] != nullptr) {
+                return buckets[index]->head;
+            }
+        }
+    }
+    return nullptr;
+}
+
+// Definition of the for_each method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+template <typename Function>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::for_each(Function fn) {
+    static constexpr size_t AHEAD = 4; // Buckets prefetched ahead of the walk
+
+    for (vector<BucketType*>* buckets : {&oldData, &data}) {
+        size_t count = buckets->size();
+        for (size_t i = 0; i < count; ++i) {
+            if (i + AHEAD < count && (*buckets)[i + AHEAD] != nullptr) {
+                __builtin_prefetch((*buckets)[i + AHEAD]);
+            }
+            BucketType* bucket = (*buckets)[i];
+            if (bucket == nullptr) {
+                continue;
+            }
+            for (NodeType* node = bucket->head; node != nullptr; node = node->next) {
+                fn(static_cast<const K &>(node->key), node->value);
+            }
+        }
+    }
+}
+
+// Definition of the migrateOldBucket method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::migrateOldBucket(size_t index) {
+    moveBucket(oldData[index], data, capacity);
+    oldData[index] = nullptr;
+}
+
+// Definition of the rehashStep method: bounded amount of migration work
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::rehashStep() {
+    if (!rehashing()) {
+        return;
+    }
+
+    // Skipping empty slots is cheap but still bounded, so no call scans the whole table
+    size_t migrated = 0;
+    size_t visited = 0;
+    while (migrateIndex < oldCapacity && migrated < REHASH_STEP && visited < REHASH_STEP * 16) {
+        if (oldData[migrateIndex] != nullptr) {
+            migrateOldBucket(migrateIndex);
+            migrated++;
+        }
+        migrateIndex++;
+        visited++;
+    }
+
+    if (migrateIndex == oldCapacity) {
+        // Every old Bucket has moved; release the old vector and its filter
+        vector<BucketType*>().swap(oldData);
+        oldCapacity = 0;
+        if (bloomEnabled) {
+            oldBloom.reset(0);
+        }
+    }
+}
+
+// Definition of the finishRehash method: migrate everything that is left
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::finishRehash() {
+    while (rehashing()) {
+        for (; migrateIndex < oldCapacity; ++migrateIndex) {
+            if (oldData[migrateIndex] != nullptr) {
+                migrateOldBucket(migrateIndex);
+            }
+        }
+        rehashStep(); // Releases the old vector
+    }
+}
+
+// Definition of the set_incremental_rehash method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::set_incremental_rehash(bool enabled) {
+    if (!enabled) {
+        finishRehash();
+    }
+    incrementalRehash = enabled;
+}
+
+#ifdef HASH_TABLE_STATS
+// Definition of the chain_length_histogram method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+vector<size_t> BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::chain_length_histogram() const {
+    vector<size_t> histogram(1, 0);
+    auto count = [&histogram](const vector<BucketType*> &buckets) {
+        for (BucketType* bucket : buckets) {
+            size_t chain = 0;
+            for (NodeType* node = bucket != nullptr ? bucket->head : nullptr; node != nullptr; node = node->next) {
+                chain++;
+            }
+            if (chain >= histogram.size()) {
+                histogram.resize(chain + 1, 0);
+            }
+            histogram[chain]++;
+        }
+    };
+    count(oldData); // Not yet migrated Buckets of an incremental resize
+    count(data);
+    return histogram;
+}
+
+// Definition of the dump_stats method
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+void BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::dump_stats(ostream &out) const {
+    const HashTableStats &s = counters;
+    out << "HashTable stats\n";
+    out << "  length " << length << ", buckets " << capacity << ", load factor " << load_factor() << "\n";
+    size_t lookups = s.lookups.load(memory_order_relaxed);
+    size_t probes = s.probes.load(memory_order_relaxed);
+    out << "  lookups " << lookups << " (misses " << s.misses.load(memory_order_relaxed) << "), probes " << probes
+        << " (avg " << (lookups != 0 ? static_cast<double>(probes) / lookups : 0.0)
+        << ", max " << s.maxProbes.load(memory_order_relaxed) << ")\n";
+    out << "  inserts " << s.inserts << ", updates " << s.updates << ", removes " << s.removes << "\n";
+    out << "  resizes " << s.resizes << ", total " << s.resizeNanos / 1000 << " us, max "
+        << s.maxResizeNanos / 1000 << " us\n";
+    out << "  chain length histogram (length: buckets)\n";
+    vector<size_t> histogram = chain_length_histogram();
+    for (size_t chain = 0; chain < histogram.size(); ++chain) {
+        if (histogram[chain] != 0) {
+            out << "    " << chain << ": " << histogram[chain] << "\n";
+        }
+    }
+}
+#endif
+
+// Definition of the destructor
+template <typename K, typename U, typename Hash, typename KeyEqual, typename Alloc, typename Growth,
+          template <typename, typename, typename> class Chain>
+BasicHashTable<K, U, Hash, KeyEqual, Alloc, Growth, Chain>::~BasicHashTable() {
+    for (BucketType* bucket : data) {
+        deleteBucket(bucket);
+    }
+    for (BucketType* bucket : oldData) {
+        deleteBucket(bucket);
+    }
+}
+
+// The original string-keyed table: HashTable<U> maps strings to U
+template <typename U, typename Hash = WyHash, typename Alloc = std::allocator<char>,
+          typename Growth = PowerOfTwoGrowth, template <typename, typename, typename> class Chain = Bucket>
+using HashTable = BasicHashTable<string, U, Hash, std::equal_to<>, Alloc, Growth, Chain>;
+
+#endif // HASH_TABLE_H
@@ -1,123 +1,293 @@
-#ifndef HASH_TABLE_LINKED_LIST
-#define HASH_TABLE_LINKED_LIST
+#ifndef HASH_TABLE_LINKED_LIST_H
+#define HASH_TABLE_LINKED_LIST_H
 
-#include <iostream>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
 
+// Node of a HashTableLinkedList: like Node in bucket.h, but without prev,
+// which saves one pointer per entry
 template <typename T, typename U>
-class Node
+class ChainNode
 {
 public:
-    T key;
-    U value;
-    Node *next;
-    Node *prev;
+    ChainNode *next;   // Pointer to the next node
+    uint64_t hash;     // Cached hash of the key (0 when the owner does not hash)
+    T key;             // Key of the node
+    U value;           // Value associated with the key
 
-    Node() : key{}, value{}, next{nullptr} {};
-    Node(const T &keyA, const U &valueA) : key{keyA}, value{valueA}, next{nullptr} {};
+    // Constructors
+    ChainNode() : next{nullptr}, hash{0}, key{}, value{} {};
+    ChainNode(const T &keyA, const U &valueA, uint64_t hashA = 0)
+        : next{nullptr}, hash{hashA}, key{keyA}, value{valueA} {};
+
+    // Constructor building the key from keyA and the value in place from args
+    template <typename K, typename... Args>
+    ChainNode(std::piecewise_construct_t, uint64_t hashA, K &&keyA, Args &&...args)
+        : next{nullptr}, hash{hashA}, key(std::forward<K>(keyA)), value(std::forward<Args>(args)...) {};
 };
 
-template <typename T, typename U>
+// Intrusive singly linked chain with the interface of Bucket, usable as the
+// Chain parameter of BasicHashTable. New nodes go to the front, so inserts
+// and link are O(1) without a tail pointer; removal unlinks in the same walk
+// that finds the node. Alloc allocates ChainNode<T, U> objects.
+template <typename T, typename U, typename Alloc = std::allocator<ChainNode<T, U>>>
 class HashTableLinkedList
 {
 private:
-    Node<T, U> *head;
-    Node<T, U> *tail;
-    int size;
-    bool empty();
+    int size;          // Size of the linked list
+    Alloc alloc;       // Allocator for the nodes
+
+    // Private methods to allocate/free a single node through alloc
+    template <typename... Args>
+    ChainNode<T, U> *createNode(Args &&...args);
+    void destroyNode(ChainNode<T, U> *node);
+
+    // Private method to find the link pointing at the node with keyA, or at
+    // the terminating nullptr if there is none
+    template <typename K, typename Equal>
+    ChainNode<T, U> **find(const K &keyA, uint64_t hashA, const Equal &equal);
 
 public:
-    HashTableLinkedList() : head{nullptr}, tail{nullptr}, size{0} {};
+    using NodeType = ChainNode<T, U>;
+
+    ChainNode<T, U> *head;  // Pointer to the head of the linked list
+
+    // Constructor
+    explicit HashTableLinkedList(const Alloc &allocA = Alloc()) : size{0}, alloc{allocA}, head{nullptr} {};
+
+    HashTableLinkedList(const HashTableLinkedList &) = delete;
+    HashTableLinkedList &operator=(const HashTableLinkedList &) = delete;
+
+    // Method to push a key-value pair into the linked list.
+    // Returns true if a new node was added, false if an existing one was updated.
+    template <typename K, typename V, typename Equal = std::equal_to<>>
+    bool push(K &&keyA, V &&valueA, uint64_t hashA = 0, const Equal &equal = Equal());
+
+    // Method to find a key or prepend a node whose value is constructed in
+    // place from args. Returns the node and whether it was added.
+    template <typename K, typename Equal, typename... Args>
+    std::pair<ChainNode<T, U> *, bool> try_emplace(K &&keyA, uint64_t hashA, const Equal &equal, Args &&...args);
+
+    // Method to prepend an existing node whose key is known to be absent
+    void link(ChainNode<T, U> *node);
 
-    void push(const T &keyA, const U &valueA);
-    Node<T, U> *get(const T &keyA);
-    void remove(const T &key)
+    // Method to detach the head node without freeing it (nullptr if empty)
+    ChainNode<T, U> *unlinkHead();
+
+    // Method to get a node with a specific key
+    template <typename K>
+    ChainNode<T, U> *get(const K &keyA);
+
+    // Method to get a node by key and cached hash, comparing keys with equal
+    template <typename K, typename Equal = std::equal_to<>>
+    ChainNode<T, U> *get(const K &keyA, uint64_t hashA, const Equal &equal = Equal());
+
+    // Method to get a node like above and add the number of nodes visited to probes
+    template <typename K, typename Equal>
+    ChainNode<T, U> *get(const K &keyA, uint64_t hashA, const Equal &equal, size_t &probes);
+
+    // Method to remove a node with a specific key
+    template <typename K>
+    bool remove(const K &keyA);
+
+    // Method to remove a node with a specific key and cached hash
+    template <typename K, typename Equal = std::equal_to<>>
+    bool remove(const K &keyA, uint64_t hashA, const Equal &equal = Equal());
+
+    // Method to unlink and free a node of this list (false for nullptr).
+    // Walks from the head, since a node does not know its predecessor.
+    bool erase(ChainNode<T, U> *node);
+
+    // Method to check if the linked list is empty
+    bool empty() { return size == 0; }
+
+    ~HashTableLinkedList();
 };
 
-template <typename T, typename U>
+template <typename T, typename U, typename Alloc>
+template <typename... Args>
+ChainNode<T, U> *HashTableLinkedList<T, U, Alloc>::createNode(Args &&...args)
+{
+    ChainNode<T, U> *node = std::allocator_traits<Alloc>::allocate(alloc, 1);
+    try
+    {
+        std::allocator_traits<Alloc>::construct(alloc, node, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        std::allocator_traits<Alloc>::deallocate(alloc, node, 1);
+        throw;
+    }
+    return node;
+}
 
-void HashTableLinkedList<T, U>::push(const T &keyA, const U &valueA)
+template <typename T, typename U, typename Alloc>
+void HashTableLinkedList<T, U, Alloc>::destroyNode(ChainNode<T, U> *node)
 {
-    Node<T, U> *existedNode = get(&keyA);
+    std::allocator_traits<Alloc>::destroy(alloc, node);
+    std::allocator_traits<Alloc>::deallocate(alloc, node, 1);
+}
 
-    if (existedNode != nullptr)
+template <typename T, typename U, typename Alloc>
+template <typename K, typename Equal>
+ChainNode<T, U> **HashTableLinkedList<T, U, Alloc>::find(const K &keyA, uint64_t hashA, const Equal &equal)
+{
+    ChainNode<T, U> **link = &head;
+    while (*link != nullptr && !((*link)->hash == hashA && equal((*link)->key, keyA)))
     {
-        existedNode->value = valueA;
+        link = &(*link)->next;
     }
-    else
+    return link;
+}
+
+template <typename T, typename U, typename Alloc>
+template <typename K, typename V, typename Equal>
+bool HashTableLinkedList<T, U, Alloc>::push(K &&keyA, V &&valueA, uint64_t hashA, const Equal &equal)
+{
+    // valueA is only consumed when a new node is created
+    std::pair<ChainNode<T, U> *, bool> result = try_emplace(std::forward<K>(keyA), hashA, equal, std::forward<V>(valueA));
+    if (!result.second)
     {
-        Node<T, U> *newNode = new Node(keyA, valueA);
+        result.first->value = std::forward<V>(valueA);
+    }
+    return result.second;
+}
 
-        if (!empty())
-        {
-            head = newNode;
-            tail = newNode;
-        }
-        else
-        {
+template <typename T, typename U, typename Alloc>
+template <typename K, typename Equal, typename... Args>
+std::pair<ChainNode<T, U> *, bool> HashTableLinkedList<T, U, Alloc>::try_emplace(K &&keyA, uint64_t hashA, const Equal &equal, Args &&...args)
+{
+    ChainNode<T, U> *existedNode = get(keyA, hashA, equal);
+    if (existedNode != nullptr)
+    {
+        return {existedNode, false};
+    }
 
-            tail->next = newNode;
-            newNode->prev = tail;
-            tail = newNode;
-        }
-        size++;
+    ChainNode<T, U> *newNode = createNode(std::piecewise_construct, hashA, std::forward<K>(keyA), std::forward<Args>(args)...);
+    link(newNode);
+    return {newNode, true};
+}
 
-        return;
-    }
+template <typename T, typename U, typename Alloc>
+void HashTableLinkedList<T, U, Alloc>::link(ChainNode<T, U> *node)
+{
+    node->next = head;
+    head = node;
+    size++;
 }
 
-template <typename T, typename U>
-bool HashTableLinkedList<T, U>::empty()
+template <typename T, typename U, typename Alloc>
+ChainNode<T, U> *HashTableLinkedList<T, U, Alloc>::unlinkHead()
 {
-    return size == = 0;
+    ChainNode<T, U> *node = head;
+    if (node == nullptr)
+    {
+        return nullptr;
+    }
+    head = node->next;
+    node->next = nullptr;
+    size--;
+    return node;
 }
 
-template <typename T, typename U>
-Node<T, U> *HashTableLinkedList<T, U>::get(const T &keyA)
+template <typename T, typename U, typename Alloc>
+template <typename K>
+ChainNode<T, U> *HashTableLinkedList<T, U, Alloc>::get(const K &keyA)
 {
-    Node<T, U> *currNode = head;
+    ChainNode<T, U> *currNode = head;
     while (currNode)
     {
         if (currNode->key == keyA)
         {
             return currNode;
         }
+        currNode = currNode->next;
     }
+    return nullptr;
+}
 
+template <typename T, typename U, typename Alloc>
+template <typename K, typename Equal>
+ChainNode<T, U> *HashTableLinkedList<T, U, Alloc>::get(const K &keyA, uint64_t hashA, const Equal &equal)
+{
+    return *find(keyA, hashA, equal);
+}
+
+template <typename T, typename U, typename Alloc>
+template <typename K, typename Equal>
+ChainNode<T, U> *HashTableLinkedList<T, U, Alloc>::get(const K &keyA, uint64_t hashA, const Equal &equal, size_t &probes)
+{
+    ChainNode<T, U> *currNode = head;
+    while (currNode)
+    {
+        probes++;
+        if (currNode->hash == hashA && equal(currNode->key, keyA))
+        {
+            return currNode;
+        }
+        currNode = currNode->next;
+    }
     return nullptr;
 }
 
-template <typename T, typename U>
+template <typename T, typename U, typename Alloc>
+template <typename K>
+bool HashTableLinkedList<T, U, Alloc>::remove(const K &keyA)
+{
+    return erase(get(keyA));
+}
 
-void HashTableLinkedList<T, U>::remove(const T &keyA)
+template <typename T, typename U, typename Alloc>
+template <typename K, typename Equal>
+bool HashTableLinkedList<T, U, Alloc>::remove(const K &keyA, uint64_t hashA, const Equal &equal)
 {
-    Node<T, U> *nodeToDelete = get(keyA);
-    if (nodeToDelete == nullptr || empty())
+    // Unlink through the pointer that refers to the node: one walk, no prev
+    ChainNode<T, U> **link = find(keyA, hashA, equal);
+    ChainNode<T, U> *nodeToDelete = *link;
+    if (nodeToDelete == nullptr)
     {
-        return;
+        return false;
     }
-    if (nodeToDelete == head)
+    *link = nodeToDelete->next;
+    destroyNode(nodeToDelete);
+    size--;
+    return true;
+}
+
+template <typename T, typename U, typename Alloc>
+bool HashTableLinkedList<T, U, Alloc>::erase(ChainNode<T, U> *nodeToDelete)
+{
+    if (nodeToDelete == nullptr)
     {
-        nodeToDelete = head;
-        head = head->next;
-        head->prev = nullptr;
+        return false;
     }
-    else if (nodeToDelete == tail)
+    ChainNode<T, U> **link = &head;
+    while (*link != nullptr && *link != nodeToDelete)
     {
-        nodeToDelete = tail;
-        tail = tail->prev;
-        tail->next = nullptr;
+        link = &(*link)->next;
     }
-    else
+    if (*link == nullptr)
     {
-        Node<T, U> *prevNode = nodeToDelete->prev;
-        Node<T, U> *nextNode = nodeToDelete->next;
-        prevNode->next = nextNode;
-        nextNode->prev = prevNode;
+        return false; // Not a node of this list
     }
-
-    delete nodeToDelete;
+    *link = nodeToDelete->next;
+    destroyNode(nodeToDelete);
     size--;
-    return;
+    return true;
+}
+
+template <typename T, typename U, typename Alloc>
+HashTableLinkedList<T, U, Alloc>::~HashTableLinkedList()
+{
+    while (head != nullptr)
+    {
+        ChainNode<T, U> *temp = head;
+        head = head->next;
+        destroyNode(temp);
+    }
 }
 
-#endif HASH_TABLE_LINKED_LIST
+#endif // HASH_TABLE_LINKED_LIST_H
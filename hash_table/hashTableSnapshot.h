@@ -0,0 +1,348 @@
+#ifndef HASH_TABLE_SNAPSHOT_H
+#define HASH_TABLE_SNAPSHOT_H
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "hashTable.h" // Tables that snapshots are written from
+
+using namespace std;
+
+// Persistent, memory-mapped snapshots of a HashTable<U>.
+//
+// write_snapshot stores a live table in a flat binary layout:
+//
+//   Header                                  64 bytes
+//   uint64_t bucketStart[bucketCount + 1]   first entry of every bucket
+//   SnapshotEntry entries[length]           hash and key location, by bucket
+//   U values[length]                        parallel to entries
+//   char keys[]                             key bytes, back to back
+//
+// MappedHashTable maps such a file read-only and answers lookups directly
+// from the mapping: nothing is deserialized. Opening checks only the header,
+// so the kernel pages in just the buckets and keys a lookup touches; each
+// lookup checks the bucket it reads. Values are stored as raw bytes, so U must
+// be trivially copyable, and the file is only readable on a machine with the
+// same endianness and type layout.
+
+namespace snapshot_detail {
+
+constexpr char MAGIC[8] = {'H', 'T', 'S', 'N', 'A', 'P', '0', '1'};
+constexpr uint32_t VERSION = 1;
+
+// Hashed on write and on open: a reader with a different hasher or seed would
+// look in the wrong buckets, so it is rejected instead
+constexpr string_view HASHER_PROBE = "hash table snapshot";
+
+struct Header {
+    char magic[8];           // MAGIC
+    uint32_t version;        // VERSION
+    uint32_t valueSize;      // sizeof(U) of the writer
+    uint64_t hasherCheck;    // Hash of HASHER_PROBE
+    uint64_t bucketCount;    // Number of buckets, a power of two
+    uint64_t length;         // Number of key-value pairs
+    uint64_t valuesOffset;   // File offset of the values array
+    uint64_t keysOffset;     // File offset of the key bytes
+    uint64_t fileSize;       // Total size, to detect truncated files
+};
+static_assert(sizeof(Header) == 64, "snapshot header must stay 64 bytes");
+
+struct SnapshotEntry {
+    uint64_t hash;           // Full hash of the key
+    uint64_t keyOffset;      // Offset of the key within the key bytes
+    uint64_t keyLength;      // Length of the key
+};
+
+// Round offset up to a multiple of alignment (a power of two)
+inline uint64_t alignUp(uint64_t offset, uint64_t alignment) {
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+// Write all size bytes of data to fd, retrying short writes; false on error
+inline bool writeAll(int fd, const void *data, size_t size) {
+    const char *bytes = static_cast<const char *>(data);
+    while (size > 0) {
+        ssize_t written = ::write(fd, bytes, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+// Flush the directory holding path, so a rename into it survives a crash
+inline void syncParentDirectory(const string &path) {
+    size_t slash = path.find_last_of('/');
+    string dir = slash == string::npos ? "." : (slash == 0 ? "/" : path.substr(0, slash));
+    int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+}
+
+} // namespace snapshot_detail
+
+// Function to write table to path, replacing any existing file.
+// The snapshot is written and synced to path + ".tmp", then renamed over
+// path: readers that still map the old file keep its inode and contents, and
+// a crash mid-write leaves the previous snapshot intact.
+// Throws std::runtime_error if the file cannot be written.
+template <typename U, typename Hash, typename Alloc, typename Growth, template <typename, typename, typename> class Chain>
+void write_snapshot(const HashTable<U, Hash, Alloc, Growth, Chain> &table, const string &path) {
+    using namespace snapshot_detail;
+    static_assert(is_trivially_copyable_v<U>, "snapshot values are stored as raw bytes");
+
+    Hash hasher = table.hash_function();
+    uint64_t length = table.get_length();
+
+    // One bucket per entry on average keeps chains short without wasting space
+    uint64_t bucketCount = 1;
+    while (bucketCount < length) {
+        bucketCount <<= 1;
+    }
+
+    // Pass 1: collect the hash every node caches and count entries per bucket
+    vector<uint64_t> hashes;
+    vector<uint64_t> bucketStart(bucketCount + 1, 0);
+    uint64_t keyBytes = 0;
+    hashes.reserve(length);
+    for (auto it = table.begin(); it != table.end(); ++it) {
+        uint64_t hash = it.hash();
+        hashes.push_back(hash);
+        bucketStart[(hash & (bucketCount - 1)) + 1]++;
+        keyBytes += (*it).first.size();
+    }
+    for (uint64_t i = 0; i < bucketCount; ++i) {
+        bucketStart[i + 1] += bucketStart[i];
+    }
+
+    // Pass 2: place every entry in its bucket's range
+    vector<SnapshotEntry> entries(length);
+    vector<U> values(length);
+    string keys;
+    keys.reserve(keyBytes);
+    vector<uint64_t> next(bucketStart.begin(), bucketStart.end() - 1);
+    size_t i = 0;
+    for (auto entry : table) {
+        uint64_t slot = next[hashes[i] & (bucketCount - 1)]++;
+        entries[slot] = SnapshotEntry{hashes[i], keys.size(), entry.first.size()};
+        values[slot] = entry.second;
+        keys += entry.first;
+        i++;
+    }
+
+    Header header{};
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.valueSize = sizeof(U);
+    header.hasherCheck = hasher(HASHER_PROBE);
+    header.bucketCount = bucketCount;
+    header.length = length;
+    uint64_t entriesOffset = sizeof(Header) + (bucketCount + 1) * sizeof(uint64_t);
+    header.valuesOffset = alignUp(entriesOffset + length * sizeof(SnapshotEntry), alignof(U) > 8 ? alignof(U) : 8);
+    header.keysOffset = header.valuesOffset + length * sizeof(U);
+    header.fileSize = header.keysOffset + keys.size();
+
+    const string tmpPath = path + ".tmp";
+    int fd = ::open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        throw runtime_error("cannot open snapshot file for writing: " + tmpPath);
+    }
+    static const char padding[64] = {};
+    bool ok = writeAll(fd, &header, sizeof(header)) &&
+              writeAll(fd, bucketStart.data(), bucketStart.size() * sizeof(uint64_t)) &&
+              writeAll(fd, entries.data(), entries.size() * sizeof(SnapshotEntry)) &&
+              writeAll(fd, padding, header.valuesOffset - (entriesOffset + length * sizeof(SnapshotEntry))) &&
+              writeAll(fd, values.data(), values.size() * sizeof(U)) &&
+              writeAll(fd, keys.data(), keys.size()) &&
+              ::fsync(fd) == 0;
+    ok = ::close(fd) == 0 && ok;
+    if (!ok || ::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        ::unlink(tmpPath.c_str());
+        throw runtime_error("cannot write snapshot file: " + path);
+    }
+    syncParentDirectory(path);
+}
+
+// Read-only view of a snapshot file. Hash must be configured like the hasher
+// of the table the snapshot was written from (same type and seed).
+template <typename U, typename Hash = WyHash>
+class MappedHashTable {
+private:
+    static_assert(is_trivially_copyable_v<U>, "snapshot values are stored as raw bytes");
+
+    const char *base = nullptr;                       // Start of the mapping
+    size_t mappedSize = 0;                            // Length of the mapping
+    const snapshot_detail::Header *header = nullptr;  // Header at base
+    const uint64_t *bucketStart = nullptr;            // First entry of every bucket
+    const snapshot_detail::SnapshotEntry *entries = nullptr;
+    const char *values = nullptr;                     // Raw bytes of the values array
+    const char *keys = nullptr;                       // Key bytes
+    Hash hasher;                                      // Hash function object
+
+    // Private method to find the entry holding key, or length if absent
+    uint64_t find(string_view key) const;
+
+    // Private method to check the header against the file and this reader
+    void validate() const;
+
+public:
+    // Constructor mapping the snapshot at path.
+    // Throws std::runtime_error if the file is missing, truncated, corrupt,
+    // or was written with another value type or hasher.
+    explicit MappedHashTable(const string &path, const Hash &hasher = Hash());
+
+    MappedHashTable(const MappedHashTable &) = delete;
+    MappedHashTable &operator=(const MappedHashTable &) = delete;
+
+    // Method to check if a key exists in the snapshot.
+    // Lookups throw std::runtime_error if the bucket they read is corrupt.
+    bool has(string_view key) const { return find(key) != header->length; }
+
+    // Method to get the value associated with a key (U{} if absent)
+    U get(string_view key) const;
+
+    // Method to get the number of key-value pairs
+    size_t get_length() const { return header->length; }
+
+    // Method to get the number of buckets
+    size_t bucket_count() const { return header->bucketCount; }
+
+    ~MappedHashTable();
+};
+
+// Definition of the constructor
+template <typename U, typename Hash>
+MappedHashTable<U, Hash>::MappedHashTable(const string &path, const Hash &hasher) : hasher{hasher} {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw runtime_error("cannot open snapshot file: " + path);
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(snapshot_detail::Header)) {
+        close(fd);
+        throw runtime_error("snapshot file is truncated: " + path);
+    }
+    mappedSize = static_cast<size_t>(info.st_size);
+    void *mapping = mmap(nullptr, mappedSize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // The mapping keeps the file alive
+    if (mapping == MAP_FAILED) {
+        throw runtime_error("cannot map snapshot file: " + path);
+    }
+
+    base = static_cast<const char *>(mapping);
+    header = reinterpret_cast<const snapshot_detail::Header *>(base);
+    try {
+        validate();
+    } catch (...) {
+        munmap(mapping, mappedSize);
+        throw;
+    }
+    bucketStart = reinterpret_cast<const uint64_t *>(base + sizeof(snapshot_detail::Header));
+    entries = reinterpret_cast<const snapshot_detail::SnapshotEntry *>(bucketStart + header->bucketCount + 1);
+    values = base + header->valuesOffset;
+    keys = base + header->keysOffset;
+}
+
+// Definition of the validate method
+template <typename U, typename Hash>
+void MappedHashTable<U, Hash>::validate() const {
+    using namespace snapshot_detail;
+
+    if (memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->version != VERSION) {
+        throw runtime_error("not a hash table snapshot");
+    }
+    if (header->valueSize != sizeof(U)) {
+        throw runtime_error("snapshot was written with a different value type");
+    }
+    if (header->hasherCheck != hasher(HASHER_PROBE)) {
+        throw runtime_error("snapshot was written with a different hasher or seed");
+    }
+    // Every size is checked against the bytes left in the file before it is
+    // used, so hostile values can neither overflow nor point past the mapping
+    if (header->fileSize != mappedSize || header->bucketCount == 0 ||
+        (header->bucketCount & (header->bucketCount - 1)) != 0 ||
+        header->bucketCount >= (mappedSize - sizeof(Header)) / sizeof(uint64_t)) {
+        throw runtime_error("snapshot file is corrupt");
+    }
+    uint64_t entriesOffset = sizeof(Header) + (header->bucketCount + 1) * sizeof(uint64_t);
+    if (header->length > (mappedSize - entriesOffset) / sizeof(SnapshotEntry)) {
+        throw runtime_error("snapshot file is corrupt");
+    }
+    uint64_t entriesEnd = entriesOffset + header->length * sizeof(SnapshotEntry);
+    if (header->valuesOffset < entriesEnd || header->valuesOffset > mappedSize ||
+        header->length > (mappedSize - header->valuesOffset) / sizeof(U) ||
+        header->keysOffset != header->valuesOffset + header->length * sizeof(U)) {
+        throw runtime_error("snapshot file is corrupt");
+    }
+
+    // Only the ends of the bucket offsets are checked here; reading the whole
+    // index would page it all in before the first lookup. find checks the
+    // bucket and entries it visits instead
+    const uint64_t *starts = reinterpret_cast<const uint64_t *>(base + sizeof(Header));
+    if (starts[0] != 0 || starts[header->bucketCount] != header->length) {
+        throw runtime_error("snapshot file is corrupt");
+    }
+}
+
+// Definition of the find method
+template <typename U, typename Hash>
+uint64_t MappedHashTable<U, Hash>::find(string_view key) const {
+    uint64_t hash = hasher(key);
+    uint64_t bucket = hash & (header->bucketCount - 1);
+    uint64_t first = bucketStart[bucket];
+    uint64_t last = bucketStart[bucket + 1];
+    if (first > last || last > header->length) {
+        throw runtime_error("snapshot file is corrupt");
+    }
+
+    // Entries of a bucket are contiguous, so a lookup reads one short run
+    uint64_t keyBytes = mappedSize - header->keysOffset;
+    for (uint64_t i = first; i < last; ++i) {
+        const snapshot_detail::SnapshotEntry &entry = entries[i];
+        if (entry.keyOffset > keyBytes || entry.keyLength > keyBytes - entry.keyOffset) {
+            throw runtime_error("snapshot file is corrupt");
+        }
+        if (entry.hash == hash && entry.keyLength == key.size() &&
+            memcmp(keys + entry.keyOffset, key.data(), key.size()) == 0) {
+            return i;
+        }
+    }
+    return header->length;
+}
+
+// Definition of the get method
+template <typename U, typename Hash>
+U MappedHashTable<U, Hash>::get(string_view key) const {
+    uint64_t index = find(key);
+    if (index == header->length) {
+        return U{}; // Return default value if key is not found
+    }
+    U value;
+    memcpy(&value, values + index * sizeof(U), sizeof(U));
+    return value;
+}
+
+// Definition of the destructor
+template <typename U, typename Hash>
+MappedHashTable<U, Hash>::~MappedHashTable() {
+    munmap(const_cast<char *>(base), mappedSize);
+}
+
+#endif // HASH_TABLE_SNAPSHOT_H
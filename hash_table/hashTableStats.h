@@ -0,0 +1,86 @@
+#ifndef HASH_TABLE_STATS_H
+#define HASH_TABLE_STATS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Optional HashTable instrumentation.
+//
+// Compile with -DHASH_TABLE_STATS to give every HashTable a HashTableStats
+// member, the stats()/reset_stats() accessors, chain_length_histogram() and
+// dump_stats(). Without the flag HASH_TABLE_STAT(...) expands to nothing, so
+// regular builds carry neither the counters nor the code that updates them.
+
+#ifdef HASH_TABLE_STATS
+#define HASH_TABLE_STAT(...) __VA_ARGS__
+#else
+#define HASH_TABLE_STAT(...)
+#endif
+
+// Counters collected by one HashTable since construction or reset_stats().
+// Lookups may run concurrently under a shared lock (see ConcurrentHashTable),
+// so their counters are relaxed atomics; writes already hold the table
+// exclusively and use plain counters.
+struct HashTableStats {
+    std::atomic<size_t> lookups{0};  // Keys looked up by has/get/get_many
+    std::atomic<size_t> misses{0};   // Lookups that found nothing
+    std::atomic<size_t> probes{0};   // Nodes compared by all lookups
+    std::atomic<size_t> maxProbes{0}; // Nodes compared by the longest lookup
+    size_t inserts = 0;              // Writes that added a key
+    size_t updates = 0;              // Writes that found the key already present
+    size_t removes = 0;              // Successful removals
+    size_t resizes = 0;              // Calls to resize, growing or shrinking
+    uint64_t resizeNanos = 0;        // Total time spent in resize
+    uint64_t maxResizeNanos = 0;     // Longest single resize
+
+    // Method to record one lookup that compared probeCount nodes
+    void recordLookup(size_t probeCount, bool found) {
+        lookups.fetch_add(1, std::memory_order_relaxed);
+        if (!found) {
+            misses.fetch_add(1, std::memory_order_relaxed);
+        }
+        probes.fetch_add(probeCount, std::memory_order_relaxed);
+        size_t seen = maxProbes.load(std::memory_order_relaxed);
+        while (probeCount > seen && !maxProbes.compare_exchange_weak(seen, probeCount, std::memory_order_relaxed)) {
+        }
+    }
+
+    // Method to zero every counter
+    void reset() {
+        lookups.store(0, std::memory_order_relaxed);
+        misses.store(0, std::memory_order_relaxed);
+        probes.store(0, std::memory_order_relaxed);
+        maxProbes.store(0, std::memory_order_relaxed);
+        inserts = 0;
+        updates = 0;
+        removes = 0;
+        resizes = 0;
+        resizeNanos = 0;
+        maxResizeNanos = 0;
+    }
+};
+
+// Adds the lifetime of a scope to the resize counters of a HashTableStats
+class ResizeTimer {
+private:
+    HashTableStats &stats;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    explicit ResizeTimer(HashTableStats &stats) : stats{stats}, start{std::chrono::steady_clock::now()} {};
+
+    ResizeTimer(const ResizeTimer &) = delete;
+    ResizeTimer &operator=(const ResizeTimer &) = delete;
+
+    ~ResizeTimer() {
+        uint64_t nanos = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        stats.resizes++;
+        stats.resizeNanos += nanos;
+        stats.maxResizeNanos = nanos > stats.maxResizeNanos ? nanos : stats.maxResizeNanos;
+    }
+};
+
+#endif // HASH_TABLE_STATS_H
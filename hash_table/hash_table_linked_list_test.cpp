@@ -0,0 +1,66 @@
+#include <cassert>
+#include <iostream>
+#include <string>
+#include "hashTableLinkedList.h"
+#include "bucket.h"
+
+using namespace std;
+
+void testHashTableLinkedList() {
+    // Test case 1: Insertion and retrieval
+    HashTableLinkedList<string, int> list;
+    list.push("key1", 10);
+    list.push("key2", 20);
+    list.push("key3", 30);
+    assert(list.get("key1")->value == 10);
+    assert(list.get("key2")->value == 20);
+    assert(list.get("key3")->value == 30);
+
+    // Test case 2: Updating existing value
+    list.push("key1", 50);
+    assert(list.get("key1")->value == 50);
+
+    // Test case 3: Removal from the middle, the front and the back
+    assert(list.remove("key2") == true);
+    assert(list.get("key2") == nullptr); // Removed, should return nullptr
+    assert(list.remove("key4") == false); // Not existing key, should return false
+    assert(list.remove("key3") == true); // Newest node, at the head
+    assert(list.remove("key1") == true);
+    assert(list.empty() == true);
+
+    // Test case 4: Moving nodes between lists without copying
+    HashTableLinkedList<string, int> other;
+    list.push("key5", 5);
+    list.push("key6", 6);
+    ChainNode<string, int> *moved = list.unlinkHead();
+    assert(moved->key == "key6");
+    other.link(moved);
+    assert(other.get("key6") == moved); // Same node, now owned by the other list
+    other.link(list.unlinkHead());
+    assert(list.empty() == true);
+    assert(list.unlinkHead() == nullptr);
+    assert(other.erase(moved) == true);
+    assert(other.get("key5")->value == 5);
+    assert(other.head->next == nullptr);
+
+    // Test case 5: Cached hashes reject nodes before comparing keys
+    HashTableLinkedList<string, int> hashed;
+    hashed.push("key1", 1, 111);
+    hashed.push("key2", 2, 222);
+    assert(hashed.get("key1", 111)->value == 1);
+    assert(hashed.get("key1", 222) == nullptr); // Hash mismatch, key never compared
+    hashed.push("key1", 10, 111); // Update through the hashed lookup
+    assert(hashed.get("key1")->value == 10);
+    assert(hashed.remove("key2", 111) == false);
+    assert(hashed.remove("key2", 222) == true);
+    assert(hashed.head->key == "key1" && hashed.head->next == nullptr);
+
+    // Test case 6: Nodes are one pointer smaller than Bucket's
+    assert(sizeof(ChainNode<string, int>) + sizeof(void *) == sizeof(Node<string, int>));
+}
+
+int main() {
+    testHashTableLinkedList(); // Run the tests
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,199 @@
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include "hashTableSnapshot.h"
+
+using namespace std;
+
+struct Point {
+    int x;
+    int y;
+};
+
+// Hasher that counts how often it is called
+struct CountingHash {
+    static size_t calls;
+    uint64_t operator()(string_view key) const {
+        calls++;
+        return WyHash()(key);
+    }
+};
+size_t CountingHash::calls = 0;
+
+// Function to overwrite 8 bytes of a file at offset
+void patch(const string &path, uint64_t offset, uint64_t value) {
+    fstream file(path, ios::binary | ios::in | ios::out);
+    file.seekp(static_cast<streamoff>(offset));
+    file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+// Function to check that opening path throws std::runtime_error
+bool rejected(const string &path) {
+    try {
+        MappedHashTable<int> mapped(path);
+    } catch (const runtime_error &) {
+        return true;
+    }
+    return false;
+}
+
+// Function to check that opening path succeeds but a lookup throws
+// std::runtime_error; the probes reach every bucket of a small snapshot
+bool rejectedOnLookup(const string &path) {
+    MappedHashTable<int> mapped(path);
+    try {
+        for (int i = 0; i < 10000; ++i) {
+            mapped.has("probe" + to_string(i));
+        }
+    } catch (const runtime_error &) {
+        return true;
+    }
+    return false;
+}
+
+// Function to run tests for write_snapshot and MappedHashTable
+void runTests() {
+    const string path = "hash_table_snapshot_test.bin";
+
+    // Test case 1: Round trip of a table with several resizes behind it
+    HashTable<int> table;
+    for (int i = 0; i < 5000; ++i) {
+        table.set("key" + to_string(i), i * 10);
+    }
+    table.remove("key7");
+    write_snapshot(table, path);
+    {
+        MappedHashTable<int> mapped(path);
+        assert(mapped.get_length() == 4999);
+        assert(mapped.get("key0") == 0);
+        assert(mapped.get("key4999") == 49990);
+        assert(mapped.has("key7") == false);
+        assert(mapped.get("key7") == 0); // Missing, should return default value (0)
+        for (int i = 0; i < 5000; ++i) {
+            assert(mapped.has("key" + to_string(i)) == (i != 7));
+        }
+    }
+
+    // Test case 2: Struct values and a seeded hasher
+    HashTable<Point> points(WyHash(42));
+    points.set("origin", Point{0, 0});
+    points.set("corner", Point{3, -4});
+    write_snapshot(points, path);
+    {
+        MappedHashTable<Point> mapped(path, WyHash(42));
+        assert(mapped.get("corner").x == 3);
+        assert(mapped.get("corner").y == -4);
+        assert(mapped.has("origin") == true);
+    }
+
+    // Test case 3: A different seed or value type is rejected
+    bool thrown = false;
+    try {
+        MappedHashTable<Point> mapped(path, WyHash(7));
+    } catch (const runtime_error &) {
+        thrown = true;
+    }
+    assert(thrown == true);
+    thrown = false;
+    try {
+        MappedHashTable<int> mapped(path, WyHash(42));
+    } catch (const runtime_error &) {
+        thrown = true;
+    }
+    assert(thrown == true);
+
+    // Test case 4: Empty table
+    HashTable<int> empty;
+    write_snapshot(empty, path);
+    {
+        MappedHashTable<int> mapped(path);
+        assert(mapped.get_length() == 0);
+        assert(mapped.has("anything") == false);
+    }
+
+    // Test case 5: Rewriting a snapshot leaves existing mappings intact
+    HashTable<int> before;
+    HashTable<int> after;
+    for (int i = 0; i < 100; ++i) {
+        before.set("key" + to_string(i), i);
+        after.set("other" + to_string(i), -i);
+    }
+    write_snapshot(before, path);
+    {
+        MappedHashTable<int> old(path);
+        write_snapshot(after, path);
+        MappedHashTable<int> fresh(path);
+        assert(old.get("key42") == 42);
+        assert(old.has("other42") == false);
+        assert(fresh.get("other42") == -42);
+        assert(fresh.has("key42") == false);
+    }
+    ifstream leftover(path + ".tmp");
+    assert(!leftover); // The temporary file was renamed away
+
+    // Test case 6: Corrupt index fields are rejected by the lookups that read them
+    const uint64_t bucketCountOffset = 24; // Header field offsets, see snapshot_detail::Header
+    const uint64_t bucketStartOffset = 64;
+    write_snapshot(before, path);
+    uint64_t buckets;
+    {
+        MappedHashTable<int> mapped(path);
+        buckets = mapped.bucket_count();
+    }
+    uint64_t entriesOffset = bucketStartOffset + (buckets + 1) * sizeof(uint64_t);
+    assert(rejectedOnLookup(path) == false);
+    patch(path, bucketStartOffset + 8 * (buckets / 2), uint64_t{1} << 40); // Bucket past the entries
+    assert(rejectedOnLookup(path) == true);
+    write_snapshot(before, path);
+    patch(path, bucketStartOffset + 8, 90); // Bucket starts no longer in order
+    patch(path, bucketStartOffset + 16, 10);
+    assert(rejectedOnLookup(path) == true);
+    write_snapshot(before, path);
+    patch(path, entriesOffset + 8, uint64_t{1} << 40); // keyOffset of the first entry
+    assert(rejectedOnLookup(path) == true);
+    write_snapshot(before, path);
+    patch(path, entriesOffset + 16, UINT64_MAX); // keyLength that would overflow
+    assert(rejectedOnLookup(path) == true);
+    write_snapshot(before, path);
+    patch(path, bucketStartOffset + 8 * buckets, 99); // Last bucket end is checked on open
+    assert(rejected(path) == true);
+    write_snapshot(before, path);
+    patch(path, bucketCountOffset, uint64_t{1} << 62); // (bucketCount + 1) * 8 overflows
+    assert(rejected(path) == true);
+
+    // Test case 7: Missing file
+    remove(path.c_str());
+    thrown = false;
+    try {
+        MappedHashTable<int> mapped(path);
+    } catch (const runtime_error &) {
+        thrown = true;
+    }
+    assert(thrown == true);
+
+    // Test case 8: Writing reuses the hashes cached in the table's nodes
+    HashTable<int, CountingHash> counted;
+    for (int i = 0; i < 500; ++i) {
+        counted.set("key" + to_string(i), i);
+    }
+    CountingHash::calls = 0;
+    write_snapshot(counted, path);
+    assert(CountingHash::calls == 1); // Only the hasher probe in the header
+    {
+        MappedHashTable<int, CountingHash> mapped(path);
+        for (int i = 0; i < 500; ++i) {
+            assert(mapped.get("key" + to_string(i)) == i);
+        }
+    }
+    remove(path.c_str());
+}
+
+int main() {
+    runTests(); // Run the tests
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
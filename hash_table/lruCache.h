@@ -0,0 +1,257 @@
+#ifndef LRU_CACHE_H
+#define LRU_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "hashTable.h" // Key index
+#include "poolAllocator.h" // Recycles the index's Nodes
+
+using namespace std;
+
+// Bounded least-recently-used cache.
+//
+// All entries are allocated once, up front. A HashTable maps each key to its
+// Entry, and the Entries form an intrusive doubly linked recency list (most
+// recently used at the head). get and put move an Entry to the head; when the
+// cache is over its entry or byte budget, Entries are evicted from the tail
+// and recycled, and their values released at once. Each key is stored once,
+// in its Entry; the index holds a pointer to it. The index is reserved for the
+// full capacity and allocates its Nodes through Alloc, by default from a
+// SlabPool, so once warm get never allocates, and put only allocates if
+// copying the key does: a recycled Entry assigns the new key over the evicted
+// one, so e.g. a string key reuses the evicted key's buffer unless it is
+// longer than any key that Entry held before.
+//
+// One spare Entry beyond the capacity is kept free, so put fills a new Entry
+// before it evicts anything: if copying the key or moving the value throws,
+// the cache is left as it was.
+// Hash maps a key to a 64-bit hash (see hashFunctions.h).
+template <typename K, typename V, typename Hash = DefaultHash<K>, typename Alloc = PoolAllocator<char>>
+class LRUCache {
+private:
+    struct Entry {
+        K key;
+        V value;
+        size_t bytes = 0;        // Charge against the byte budget
+        Entry *prev = nullptr;   // Towards the most recently used
+        Entry *next = nullptr;   // Towards the least recently used; free list link
+    };
+
+    // The index is keyed by pointers to Entry::key, hashed and compared
+    // through the pointer; lookups pass a pointer to the caller's key
+    struct KeyHash {
+        Hash hasher;
+        uint64_t operator()(const K *key) const { return static_cast<uint64_t>(hasher(*key)); }
+    };
+    struct KeyEqual {
+        bool operator()(const K *a, const K *b) const { return *a == *b; }
+    };
+
+    using Index = BasicHashTable<const K *, Entry *, KeyHash, KeyEqual, Alloc>;
+
+    vector<Entry> entries; // Preallocated storage plus the spare, never resized
+    Index index;           // &Entry::key -> Entry
+    Entry *head = nullptr; // Most recently used
+    Entry *tail = nullptr; // Least recently used, evicted first
+    Entry *freeList = nullptr; // Unused Entries, linked through next
+    size_t length = 0;     // Number of cached entries
+    size_t maxBytes;       // Byte budget
+    size_t usedBytes = 0;  // Sum of bytes over cached entries
+
+    // Private methods for the recency list
+    void unlink(Entry *entry);
+    void pushFront(Entry *entry);
+    void moveToFront(Entry *entry);
+
+    // Private method to drop the least recently used entry
+    void evictTail();
+
+    // Private method to evict until the byte budget holds
+    void evictToBudget();
+
+public:
+    // Constructor for a cache of at most maxEntries entries whose bytes,
+    // as passed to put, sum to at most maxBytes. The index allocates through alloc.
+    // Throws std::invalid_argument if maxEntries is 0.
+    explicit LRUCache(size_t maxEntries, size_t maxBytes = SIZE_MAX, const Hash &hasher = Hash(),
+                      const Alloc &alloc = Alloc());
+
+    LRUCache(const LRUCache &) = delete;
+    LRUCache &operator=(const LRUCache &) = delete;
+
+    // Method to look a key up and mark it most recently used. Returns a
+    // pointer to the value, valid until the entry is evicted or removed,
+    // or nullptr if the key is not cached.
+    V *get(const K &key);
+
+    // Method to check if a key is cached, without touching its recency
+    bool has(const K &key) { return index.has(&key); }
+
+    // Method to insert or replace a value charged bytes against the byte
+    // budget, evicting least recently used entries as needed.
+    // Returns false (and drops any old value) if bytes alone exceed the budget.
+    // If copying the key or moving the value throws, no entry is evicted.
+    bool put(const K &key, V value, size_t bytes = 0);
+
+    // Method to remove a key from the cache
+    bool remove(const K &key);
+
+    // Method to get the number of cached entries
+    size_t get_length() const { return length; }
+
+    // Method to get the maximum number of entries
+    size_t capacity() const { return entries.size() - 1; }
+
+    // Method to get the bytes charged by cached entries
+    size_t bytes_used() const { return usedBytes; }
+};
+
+// Definition of the constructor
+template <typename K, typename V, typename Hash, typename Alloc>
+LRUCache<K, V, Hash, Alloc>::LRUCache(size_t maxEntries, size_t maxBytes, const Hash &hasher, const Alloc &alloc)
+    : entries(maxEntries + 1), index(KeyHash{hasher}, KeyEqual(), alloc), maxBytes{maxBytes} {
+    if (maxEntries == 0) {
+        throw invalid_argument("LRUCache needs room for at least one entry");
+    }
+    index.reserve(maxEntries + 1); // A full cache indexes the new key before evicting
+    for (size_t i = entries.size(); i-- > 0;) {
+        entries[i].next = freeList;
+        freeList = &entries[i];
+    }
+}
+
+// Definition of the unlink method
+template <typename K, typename V, typename Hash, typename Alloc>
+void LRUCache<K, V, Hash, Alloc>::unlink(Entry *entry) {
+    if (entry->prev != nullptr) {
+        entry->prev->next = entry->next;
+    } else {
+        head = entry->next;
+    }
+    if (entry->next != nullptr) {
+        entry->next->prev = entry->prev;
+    } else {
+        tail = entry->prev;
+    }
+    entry->prev = nullptr;
+    entry->next = nullptr;
+}
+
+// Definition of the pushFront method
+template <typename K, typename V, typename Hash, typename Alloc>
+void LRUCache<K, V, Hash, Alloc>::pushFront(Entry *entry) {
+    entry->prev = nullptr;
+    entry->next = head;
+    if (head != nullptr) {
+        head->prev = entry;
+    } else {
+        tail = entry;
+    }
+    head = entry;
+}
+
+// Definition of the moveToFront method
+template <typename K, typename V, typename Hash, typename Alloc>
+void LRUCache<K, V, Hash, Alloc>::moveToFront(Entry *entry) {
+    if (entry != head) {
+        unlink(entry);
+        pushFront(entry);
+    }
+}
+
+// Definition of the evictTail method: the value is released and the Entry
+// goes back to the free list, keeping only its key's storage for reuse
+template <typename K, typename V, typename Hash, typename Alloc>
+void LRUCache<K, V, Hash, Alloc>::evictTail() {
+    Entry *victim = tail;
+    unlink(victim);
+    index.remove(&victim->key);
+    victim->value = V{};
+    usedBytes -= victim->bytes;
+    victim->bytes = 0;
+    victim->next = freeList;
+    freeList = victim;
+    length--;
+}
+
+// Definition of the evictToBudget method
+template <typename K, typename V, typename Hash, typename Alloc>
+void LRUCache<K, V, Hash, Alloc>::evictToBudget() {
+    // The head was just put and fits the budget on its own, so it survives
+    while (usedBytes > maxBytes) {
+        evictTail();
+    }
+}
+
+// Definition of the get method
+template <typename K, typename V, typename Hash, typename Alloc>
+V *LRUCache<K, V, Hash, Alloc>::get(const K &key) {
+    Entry *entry = index.get(&key);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+    moveToFront(entry);
+    return &entry->value;
+}
+
+// Definition of the put method
+template <typename K, typename V, typename Hash, typename Alloc>
+bool LRUCache<K, V, Hash, Alloc>::put(const K &key, V value, size_t bytes) {
+    if (bytes > maxBytes) {
+        remove(key); // Never cache it, and do not leave a stale value behind
+        return false;
+    }
+
+    Entry *entry = index.get(&key);
+    if (entry != nullptr) {
+        entry->value = std::move(value);
+        usedBytes = usedBytes - entry->bytes + bytes;
+        entry->bytes = bytes;
+        moveToFront(entry);
+        evictToBudget();
+        return true;
+    }
+
+    // The spare keeps freeList non-empty. The Entry only leaves it once the
+    // key, value and index slot are in place, so a throw changes nothing.
+    entry = freeList;
+    entry->key = key; // Reuses the evicted key's storage where K allows
+    entry->value = std::move(value);
+    index.try_emplace(&entry->key, entry); // The index points at the key in the Entry
+    freeList = entry->next;
+    entry->bytes = bytes;
+    usedBytes += bytes;
+    length++;
+    pushFront(entry);
+    if (length > capacity()) {
+        evictTail(); // The evicted Entry becomes the spare
+    }
+    evictToBudget();
+    return true;
+}
+
+// Definition of the remove method
+template <typename K, typename V, typename Hash, typename Alloc>
+bool LRUCache<K, V, Hash, Alloc>::remove(const K &key) {
+    Entry *entry = index.get(&key);
+    if (entry == nullptr) {
+        return false;
+    }
+    // Make it the tail so eviction does the bookkeeping
+    unlink(entry);
+    entry->prev = tail;
+    if (tail != nullptr) {
+        tail->next = entry;
+    } else {
+        head = entry;
+    }
+    tail = entry;
+    evictTail();
+    return true;
+}
+
+#endif // LRU_CACHE_H
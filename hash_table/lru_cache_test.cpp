@@ -0,0 +1,202 @@
+#include <iostream>
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "lruCache.h"
+
+using namespace std;
+
+// Allocator that counts every allocation made for string keys
+static size_t keyAllocations = 0;
+
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template <typename V>
+    CountingAllocator(const CountingAllocator<V> &) {}
+
+    T *allocate(size_t n) {
+        keyAllocations++;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+    template <typename V>
+    bool operator==(const CountingAllocator<V> &) const { return true; }
+    template <typename V>
+    bool operator!=(const CountingAllocator<V> &) const { return false; }
+};
+
+using CountedString = basic_string<char, char_traits<char>, CountingAllocator<char>>;
+
+// Type whose copies and moves throw on demand
+struct Fragile {
+    static bool failCopy;
+    static bool failMove;
+    int id = 0;
+
+    Fragile() = default;
+    explicit Fragile(int idA) : id{idA} {}
+    Fragile(const Fragile &other) : id{other.id} {
+        if (failCopy) {
+            throw runtime_error("copy");
+        }
+    }
+    Fragile(Fragile &&other) : id{other.id} {
+        if (failMove) {
+            throw runtime_error("move");
+        }
+    }
+    Fragile &operator=(const Fragile &other) {
+        if (failCopy) {
+            throw runtime_error("copy");
+        }
+        id = other.id;
+        return *this;
+    }
+    Fragile &operator=(Fragile &&other) {
+        if (failMove) {
+            throw runtime_error("move");
+        }
+        id = other.id;
+        return *this;
+    }
+    bool operator==(const Fragile &other) const { return id == other.id; }
+};
+bool Fragile::failCopy = false;
+bool Fragile::failMove = false;
+
+struct FragileHash {
+    uint64_t operator()(const Fragile &key) const { return IntegerHash()(static_cast<uint64_t>(key.id)); }
+};
+
+// Function to run tests for the LRUCache class
+void runTests() {
+    // Test case 1: Least recently used entries are evicted first
+    LRUCache<string, int> cache(3);
+    cache.put("a", 1);
+    cache.put("b", 2);
+    cache.put("c", 3);
+    assert(*cache.get("a") == 1); // "b" is now the least recently used
+    cache.put("d", 4);
+    assert(cache.get("b") == nullptr);
+    assert(cache.has("a") == true);
+    assert(cache.has("c") == true);
+    assert(cache.has("d") == true);
+    assert(cache.get_length() == 3);
+
+    // Test case 2: Updating an entry refreshes it
+    cache.put("c", 30); // "a" is now the least recently used
+    cache.put("e", 5);
+    assert(cache.has("a") == false);
+    assert(*cache.get("c") == 30);
+
+    // Test case 3: Removal frees a slot without evicting
+    assert(cache.remove("d") == true);
+    assert(cache.remove("d") == false);
+    cache.put("f", 6);
+    assert(cache.get_length() == 3);
+    assert(cache.has("c") && cache.has("e") && cache.has("f"));
+
+    // Test case 4: Byte budget
+    LRUCache<int, int> sized(100, 10);
+    sized.put(1, 1, 4);
+    sized.put(2, 2, 4);
+    sized.put(3, 3, 4); // 12 bytes: evicts 1
+    assert(sized.has(1) == false);
+    assert(sized.bytes_used() == 8);
+    sized.put(2, 20, 1); // Shrinking an entry
+    assert(sized.bytes_used() == 5);
+    assert(sized.put(4, 4, 11) == false); // Larger than the whole budget
+    assert(sized.has(4) == false);
+    sized.put(5, 5, 10); // Evicts everything else
+    assert(sized.get_length() == 1);
+    assert(*sized.get(5) == 5);
+
+    // Test case 5: No allocation once warm
+    PoolAllocator<char> alloc; // Shares its pool with the index, to watch its slabs
+    LRUCache<uint64_t, uint64_t> warm(1000, SIZE_MAX, IntegerHash(), alloc);
+    for (uint64_t i = 0; i < 5000; ++i) {
+        warm.put(i, i);
+    }
+    size_t before = alloc.resource().slab_count();
+    assert(before > 0); // The index draws its Nodes from the pool
+    for (uint64_t i = 0; i < 100000; ++i) {
+        warm.put(i % 3000, i);
+        warm.get(i % 1500);
+    }
+    assert(alloc.resource().slab_count() == before);
+    assert(warm.get_length() == 1000);
+
+    // Test case 6: Long string keys reuse the storage of evicted keys
+    vector<CountedString> keys;
+    for (int i = 0; i < 300; ++i) {
+        string suffix = to_string(1000 + i);
+        keys.push_back(CountedString("a-key-long-enough-to-spill-") + suffix.c_str()); // 31 chars, past the SSO buffer
+    }
+    PoolAllocator<char> stringAlloc;
+    LRUCache<CountedString, int, WyHash> strings(100, SIZE_MAX, WyHash(), stringAlloc);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        strings.put(keys[i], static_cast<int>(i));
+    }
+    before = stringAlloc.resource().slab_count();
+    size_t keysBefore = keyAllocations;
+    for (size_t i = 0; i < 3000; ++i) {
+        strings.put(keys[(i * 7) % keys.size()], static_cast<int>(i));
+        assert(strings.get(keys[(i * 7) % keys.size()]) != nullptr);
+    }
+    assert(stringAlloc.resource().slab_count() == before);
+    assert(keyAllocations == keysBefore);
+    assert(strings.get_length() == 100);
+    assert(*strings.get(keys[(2999 * 7) % keys.size()]) == 2999);
+    assert(strings.has(keys[(2999 * 7 + 7) % keys.size()]) == false);
+
+    // Test case 7: Removed and evicted values are released at once
+    LRUCache<int, shared_ptr<int>> owners(2);
+    owners.put(1, make_shared<int>(7));
+    weak_ptr<int> removed = *owners.get(1);
+    owners.remove(1);
+    assert(removed.expired());
+    owners.put(2, make_shared<int>(8));
+    weak_ptr<int> evicted = *owners.get(2);
+    owners.put(3, make_shared<int>(9));
+    owners.put(4, make_shared<int>(10)); // Evicts 2
+    assert(owners.has(2) == false);
+    assert(evicted.expired());
+
+    // Test case 8: A throwing key copy or value move evicts nothing
+    LRUCache<Fragile, Fragile, FragileHash> fragile(2);
+    fragile.put(Fragile(1), Fragile(10));
+    fragile.put(Fragile(2), Fragile(20));
+    for (bool copy : {true, false}) {
+        Fragile::failCopy = copy;
+        Fragile::failMove = !copy;
+        bool threw = false;
+        try {
+            fragile.put(Fragile(3), Fragile(30)); // The value is built in place, so only put copies or moves
+        } catch (const runtime_error &) {
+            threw = true;
+        }
+        Fragile::failCopy = false;
+        Fragile::failMove = false;
+        assert(threw);
+        assert(fragile.get_length() == 2);
+        assert(fragile.has(Fragile(1)) && fragile.has(Fragile(2)));
+        assert(fragile.has(Fragile(3)) == false);
+    }
+    fragile.put(Fragile(3), Fragile(30)); // Still evicts 1, the least recently used
+    assert(fragile.has(Fragile(1)) == false);
+    assert(fragile.get(Fragile(2))->id == 20);
+    assert(fragile.get(Fragile(3))->id == 30);
+    assert(fragile.capacity() == 2);
+}
+
+int main() {
+    runTests(); // Run the tests
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,156 @@
+#ifndef POOL_ALLOCATOR_H
+#define POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+// Slab pool handing out fixed-size blocks.
+//
+// Blocks are carved from large slabs and recycled through one free list per
+// block size, so allocating a Node or Bucket is a pointer pop instead of a
+// trip through the general-purpose allocator. Slabs are only returned to the
+// system when the pool is destroyed, all at once. Not thread-safe.
+class SlabPool {
+private:
+    static constexpr size_t SLAB_BYTES = 64 * 1024; // Size of one slab
+    static constexpr size_t ALIGNMENT = alignof(std::max_align_t);
+
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+    struct SizeClass {
+        size_t blockSize;         // Bytes per block, a multiple of ALIGNMENT
+        FreeBlock *freeList;      // Recycled blocks
+        char *cursor;             // Next uncarved byte of the current slab
+        char *end;                // End of the current slab
+    };
+
+    std::vector<SizeClass> classes; // A table usually needs two: Node and Bucket
+    std::vector<void *> slabs;      // Every slab ever allocated
+
+    SizeClass &classFor(size_t blockSize);
+
+public:
+    SlabPool() = default;
+    SlabPool(const SlabPool &) = delete;
+    SlabPool &operator=(const SlabPool &) = delete;
+
+    // Method to get a block of at least bytes bytes
+    void *allocate(size_t bytes);
+
+    // Method to return a block obtained from allocate with the same size
+    void deallocate(void *block, size_t bytes);
+
+    // Method to get the number of slabs owned by the pool
+    size_t slab_count() const { return slabs.size(); }
+
+    ~SlabPool();
+};
+
+inline SlabPool::SizeClass &SlabPool::classFor(size_t blockSize) {
+    for (SizeClass &sizeClass : classes) {
+        if (sizeClass.blockSize == blockSize) {
+            return sizeClass;
+        }
+    }
+    classes.push_back(SizeClass{blockSize, nullptr, nullptr, nullptr});
+    return classes.back();
+}
+
+inline void *SlabPool::allocate(size_t bytes) {
+    size_t blockSize = (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    SizeClass &sizeClass = classFor(blockSize);
+
+    // Reuse a freed block first
+    if (sizeClass.freeList != nullptr) {
+        FreeBlock *block = sizeClass.freeList;
+        sizeClass.freeList = block->next;
+        return block;
+    }
+
+    // Otherwise carve the next block, starting a new slab when this one is used up
+    if (sizeClass.cursor == nullptr || static_cast<size_t>(sizeClass.end - sizeClass.cursor) < blockSize) {
+        size_t slabBytes = blockSize > SLAB_BYTES ? blockSize : SLAB_BYTES;
+        char *slab = static_cast<char *>(::operator new(slabBytes));
+        slabs.push_back(slab);
+        sizeClass.cursor = slab;
+        sizeClass.end = slab + slabBytes;
+    }
+    void *block = sizeClass.cursor;
+    sizeClass.cursor += blockSize;
+    return block;
+}
+
+inline void SlabPool::deallocate(void *block, size_t bytes) {
+    size_t blockSize = (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    SizeClass &sizeClass = classFor(blockSize);
+    FreeBlock *freed = static_cast<FreeBlock *>(block);
+    freed->next = sizeClass.freeList;
+    sizeClass.freeList = freed;
+}
+
+inline SlabPool::~SlabPool() {
+    for (void *slab : slabs) {
+        ::operator delete(slab);
+    }
+}
+
+// Standard allocator backed by a shared SlabPool.
+//
+// Copies and rebinds share one pool, so a HashTable and all of its Buckets
+// draw Nodes and Buckets from the same slabs, which are released together
+// when the last copy (normally the table itself) is destroyed. Requests for
+// arrays or over-aligned types fall through to operator new.
+template <typename T>
+class PoolAllocator {
+private:
+    template <typename V>
+    friend class PoolAllocator;
+
+    std::shared_ptr<SlabPool> pool;
+
+public:
+    using value_type = T;
+
+    PoolAllocator() : pool{std::make_shared<SlabPool>()} {};
+
+    template <typename V>
+    PoolAllocator(const PoolAllocator<V> &other) : pool{other.pool} {};
+
+    T *allocate(size_t n) {
+        if constexpr (alignof(T) > alignof(std::max_align_t)) {
+            return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+        } else {
+            if (n != 1) {
+                return static_cast<T *>(::operator new(n * sizeof(T)));
+            }
+            return static_cast<T *>(pool->allocate(sizeof(T)));
+        }
+    }
+
+    void deallocate(T *block, size_t n) {
+        if constexpr (alignof(T) > alignof(std::max_align_t)) {
+            ::operator delete(block, std::align_val_t{alignof(T)});
+        } else {
+            if (n != 1) {
+                ::operator delete(block);
+                return;
+            }
+            pool->deallocate(block, sizeof(T));
+        }
+    }
+
+    // Method to get the shared pool, e.g. to inspect slab usage
+    const SlabPool &resource() const { return *pool; }
+
+    template <typename V>
+    bool operator==(const PoolAllocator<V> &other) const { return pool == other.pool; }
+
+    template <typename V>
+    bool operator!=(const PoolAllocator<V> &other) const { return pool != other.pool; }
+};
+
+#endif // POOL_ALLOCATOR_H
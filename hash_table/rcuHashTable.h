@@ -0,0 +1,320 @@
+#ifndef RCU_HASH_TABLE_H
+#define RCU_HASH_TABLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "hashFunctions.h" // Default hashers
+
+using namespace std;
+
+// Read-optimized concurrent hash table with wait-free lookups.
+//
+// has/get never lock: they announce themselves in a per-thread reader slot,
+// walk an immutable chain and leave. set/remove are serialized per bucket by
+// a striped mutex and never modify a node readers might be looking at;
+// instead they publish a replacement node and retire the old one.
+//
+// Retired nodes are freed with epoch-based reclamation (RCU-style grace
+// periods): readers count themselves in one of two epoch parities, and a
+// writer only frees a batch after both parities have drained once since the
+// nodes were unlinked, i.e. after every reader that could have seen them left.
+template <typename U, typename Hash = WyHash>
+class RcuHashTable {
+private:
+    struct RcuNode {
+        const string key;             // Key of the node
+        const U value;                // Value associated with the key, never modified
+        const uint64_t hash;          // Full hash of the key
+        atomic<RcuNode *> next;       // Pointer to the next node in the chain
+
+        RcuNode(const string &keyA, const U &valueA, uint64_t hashA, RcuNode *nextA)
+            : key{keyA}, value{valueA}, hash{hashA}, next{nextA} {};
+    };
+
+    struct Table {
+        size_t capacity;                        // Number of buckets, a power of two
+        unique_ptr<atomic<RcuNode *>[]> buckets; // Chain heads
+
+        explicit Table(size_t capacity) : capacity{capacity}, buckets{new atomic<RcuNode *>[capacity]} {
+            for (size_t i = 0; i < capacity; ++i) {
+                buckets[i].store(nullptr, memory_order_relaxed);
+            }
+        };
+    };
+
+    // Reader counters per epoch parity, one cache line per slot
+    struct alignas(64) ReaderSlot {
+        atomic<size_t> active[2] = {{0}, {0}};
+    };
+
+    struct alignas(64) StripeLock {
+        mutex lock;
+    };
+
+    static constexpr size_t LOCK_STRIPES = 64; // Writer locks; also the minimum capacity
+    static constexpr size_t READER_SLOTS = 64; // Reader counters, shared modulo thread index
+    static constexpr size_t RECLAIM_BATCH = 128; // Retired nodes freed per grace period
+    static constexpr float loadFactorThreshold = 0.75;
+
+    atomic<Table *> table; // Current bucket array
+    atomic<size_t> size{0}; // Current number of elements
+    atomic<unsigned> epoch{0}; // Parity new readers register under
+    Hash hasher; // Hash function object
+
+    mutable ReaderSlot readers[READER_SLOTS];
+    StripeLock stripes[LOCK_STRIPES];
+
+    mutex retireLock; // Guards retired
+    vector<RcuNode *> retired; // Unlinked nodes waiting for a grace period
+    mutex graceLock; // Serializes grace periods
+
+    // RAII read-side critical section
+    class ReadGuard {
+    private:
+        atomic<size_t> &counter;
+
+    public:
+        explicit ReadGuard(const RcuHashTable &owner)
+            : counter{owner.readers[threadSlot()].active[owner.epoch.load() & 1]} {
+            counter.fetch_add(1);
+        };
+        ~ReadGuard() { counter.fetch_sub(1); };
+    };
+
+    static size_t threadSlot();
+
+    // Private method to find a node in the current table (caller is a reader or holds the stripe)
+    RcuNode *find(const string &key, uint64_t hash) const;
+
+    // Private methods for reclamation
+    void retire(RcuNode *node);
+    void synchronize();
+    void resize();
+
+public:
+    // Constructor to initialize the RcuHashTable
+    explicit RcuHashTable(const Hash &hasher = Hash()) : table{new Table(128)}, hasher{hasher} {};
+
+    RcuHashTable(const RcuHashTable &) = delete;
+    RcuHashTable &operator=(const RcuHashTable &) = delete;
+
+    // Method to check if a key exists in the RcuHashTable (wait-free)
+    bool has(const string &key) const;
+
+    // Method to get the value associated with a key (wait-free)
+    U get(const string &key) const;
+
+    // Method to set a key-value pair in the RcuHashTable
+    void set(const string &key, const U &value);
+
+    // Method to remove a key-value pair from the RcuHashTable
+    bool remove(const string &key);
+
+    ~RcuHashTable();
+};
+
+// Definition of the threadSlot method: fixed per thread, assigned round-robin
+template <typename U, typename Hash>
+size_t RcuHashTable<U, Hash>::threadSlot() {
+    static atomic<size_t> nextSlot{0};
+    thread_local size_t slot = nextSlot.fetch_add(1, memory_order_relaxed) % READER_SLOTS;
+    return slot;
+}
+
+// Definition of the find method
+template <typename U, typename Hash>
+typename RcuHashTable<U, Hash>::RcuNode *RcuHashTable<U, Hash>::find(const string &key, uint64_t hash) const {
+    Table *t = table.load();
+    RcuNode *node = t->buckets[hash & (t->capacity - 1)].load();
+    // Compare the cached hash first; full string compares only on a hash match
+    while (node != nullptr && !(node->hash == hash && node->key == key)) {
+        node = node->next.load();
+    }
+    return node;
+}
+
+// Definition of the has method
+template <typename U, typename Hash>
+bool RcuHashTable<U, Hash>::has(const string &key) const {
+    uint64_t hash = hasher(key);
+    ReadGuard guard(*this);
+    return find(key, hash) != nullptr;
+}
+
+// Definition of the get method
+template <typename U, typename Hash>
+U RcuHashTable<U, Hash>::get(const string &key) const {
+    uint64_t hash = hasher(key);
+    ReadGuard guard(*this);
+    RcuNode *node = find(key, hash);
+    if (node != nullptr) {
+        return node->value; // Copy out while the node is protected
+    }
+    return U{}; // Return default value if key is not found
+}
+
+// Definition of the set method
+template <typename U, typename Hash>
+void RcuHashTable<U, Hash>::set(const string &key, const U &value) {
+    uint64_t hash = hasher(key);
+    RcuNode *replaced = nullptr;
+    size_t capacity = 0; // Read under the lock; the table may be freed once it is released
+    {
+        // The stripe covers every bucket this hash can map to, at any capacity
+        lock_guard<mutex> guard(stripes[hash & (LOCK_STRIPES - 1)].lock);
+        Table *t = table.load();
+        capacity = t->capacity;
+        atomic<RcuNode *> *link = &t->buckets[hash & (t->capacity - 1)];
+
+        // Find the link pointing at an existing node with this key
+        RcuNode *current = link->load();
+        while (current != nullptr && !(current->hash == hash && current->key == key)) {
+            link = &current->next;
+            current = link->load();
+        }
+
+        if (current != nullptr) {
+            // Publish a replacement; readers already on the old node still see a valid chain
+            link->store(new RcuNode(key, value, hash, current->next.load()));
+            replaced = current;
+        } else {
+            // New keys go in front of the chain
+            atomic<RcuNode *> &head = t->buckets[hash & (t->capacity - 1)];
+            head.store(new RcuNode(key, value, hash, head.load()));
+            size.fetch_add(1);
+        }
+    }
+
+    if (replaced != nullptr) {
+        retire(replaced);
+    } else if (size.load() >= static_cast<size_t>(capacity * loadFactorThreshold)) {
+        resize(); // Resize the table if load factor exceeds the threshold
+    }
+}
+
+// Definition of the remove method
+template <typename U, typename Hash>
+bool RcuHashTable<U, Hash>::remove(const string &key) {
+    uint64_t hash = hasher(key);
+    RcuNode *removed = nullptr;
+    {
+        lock_guard<mutex> guard(stripes[hash & (LOCK_STRIPES - 1)].lock);
+        Table *t = table.load();
+        atomic<RcuNode *> *link = &t->buckets[hash & (t->capacity - 1)];
+
+        RcuNode *current = link->load();
+        while (current != nullptr && !(current->hash == hash && current->key == key)) {
+            link = &current->next;
+            current = link->load();
+        }
+        if (current == nullptr) {
+            return false;
+        }
+
+        // Unlink only; current->next stays intact for readers standing on it
+        link->store(current->next.load());
+        size.fetch_sub(1);
+        removed = current;
+    }
+    retire(removed);
+    return true;
+}
+
+// Definition of the resize method: copy into a doubled table and publish it
+template <typename U, typename Hash>
+void RcuHashTable<U, Hash>::resize() {
+    vector<unique_lock<mutex>> guards;
+    for (StripeLock &stripe : stripes) {
+        guards.emplace_back(stripe.lock); // Always locked in the same order
+    }
+
+    Table *oldTable = table.load();
+    if (size.load() < static_cast<size_t>(oldTable->capacity * loadFactorThreshold)) {
+        return; // Another writer already resized
+    }
+
+    // Readers may still walk the old chains, so nodes are copied, not relinked
+    Table *newTable = new Table(oldTable->capacity * 2);
+    for (size_t i = 0; i < oldTable->capacity; ++i) {
+        for (RcuNode *node = oldTable->buckets[i].load(); node != nullptr; node = node->next.load()) {
+            atomic<RcuNode *> &head = newTable->buckets[node->hash & (newTable->capacity - 1)];
+            head.store(new RcuNode(node->key, node->value, node->hash, head.load(memory_order_relaxed)),
+                       memory_order_relaxed);
+        }
+    }
+    table.store(newTable);
+    guards.clear();
+
+    // Wait until no reader can still be inside the old table, then free it
+    synchronize();
+    for (size_t i = 0; i < oldTable->capacity; ++i) {
+        RcuNode *node = oldTable->buckets[i].load();
+        while (node != nullptr) {
+            RcuNode *next = node->next.load();
+            delete node;
+            node = next;
+        }
+    }
+    delete oldTable;
+}
+
+// Definition of the retire method: free unlinked nodes in batches
+template <typename U, typename Hash>
+void RcuHashTable<U, Hash>::retire(RcuNode *node) {
+    vector<RcuNode *> batch;
+    {
+        lock_guard<mutex> guard(retireLock);
+        retired.push_back(node);
+        if (retired.size() < RECLAIM_BATCH) {
+            return;
+        }
+        batch.swap(retired);
+    }
+
+    synchronize();
+    for (RcuNode *old : batch) {
+        delete old;
+    }
+}
+
+// Definition of the synchronize method: wait for a full grace period.
+// Two flips are needed because a reader may load the parity just before a
+// flip and only increment its counter after it.
+template <typename U, typename Hash>
+void RcuHashTable<U, Hash>::synchronize() {
+    lock_guard<mutex> guard(graceLock);
+    for (int flip = 0; flip < 2; ++flip) {
+        unsigned draining = epoch.fetch_xor(1) & 1;
+        for (ReaderSlot &slot : readers) {
+            while (slot.active[draining].load() != 0) {
+                this_thread::yield();
+            }
+        }
+    }
+}
+
+template <typename U, typename Hash>
+RcuHashTable<U, Hash>::~RcuHashTable() {
+    // No readers may outlive the table, so everything can be freed directly
+    for (RcuNode *node : retired) {
+        delete node;
+    }
+    Table *t = table.load();
+    for (size_t i = 0; i < t->capacity; ++i) {
+        RcuNode *node = t->buckets[i].load();
+        while (node != nullptr) {
+            RcuNode *next = node->next.load();
+            delete node;
+            node = next;
+        }
+    }
+    delete t;
+}
+
+#endif // RCU_HASH_TABLE_H
@@ -0,0 +1,71 @@
+#include <iostream>
+#include <atomic>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+#include "rcuHashTable.h"
+
+using namespace std;
+
+// Function to run tests for the RcuHashTable class
+void runTests() {
+    // Test case 1: Single-threaded behaviour matches HashTable
+    RcuHashTable<int> table;
+    table.set("key1", 10);
+    table.set("key2", 20);
+    table.set("key1", 50);
+    assert(table.get("key1") == 50);
+    assert(table.remove("key2") == true);
+    assert(table.remove("key2") == false);
+    assert(table.has("key2") == false);
+    assert(table.get("key2") == 0);
+
+    // Test case 2: Lock-free readers run against writers that update,
+    // remove and grow the table; a reader sees either the old or the new value
+    for (int i = 0; i < 100; ++i) {
+        table.set("stable" + to_string(i), i);
+    }
+    atomic<bool> done{false};
+    vector<thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&table, &done]() {
+            while (!done.load()) {
+                for (int i = 0; i < 100; ++i) {
+                    int value = table.get("stable" + to_string(i));
+                    assert(value == i || value == -i);
+                }
+            }
+        });
+    }
+    vector<thread> writers;
+    for (int w = 0; w < 2; ++w) {
+        writers.emplace_back([&table, w]() {
+            for (int i = 0; i < 3000; ++i) {
+                table.set("w" + to_string(w) + "_" + to_string(i), i);
+                table.set("stable" + to_string(i % 100), (i / 100) % 2 == 0 ? -(i % 100) : i % 100);
+                if (i % 2 == 0) {
+                    table.remove("w" + to_string(w) + "_" + to_string(i));
+                }
+            }
+        });
+    }
+    for (thread &writer : writers) {
+        writer.join();
+    }
+    done.store(true);
+    for (thread &reader : readers) {
+        reader.join();
+    }
+    for (int w = 0; w < 2; ++w) {
+        for (int i = 0; i < 3000; ++i) {
+            assert(table.has("w" + to_string(w) + "_" + to_string(i)) == (i % 2 == 1));
+        }
+    }
+}
+
+int main() {
+    runTests(); // Run the tests
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,299 @@
+#ifndef ROBIN_HOOD_HASH_TABLE_H
+#define ROBIN_HOOD_HASH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "hashFunctions.h" // Default hashers
+
+using namespace std;
+
+// Open-addressing hash table with Robin Hood linear probing.
+//
+// Every slot records its entry's probe distance, i.e. how far it sits from
+// its home slot. An insert that meets an entry closer to home than itself
+// takes that slot and carries the displaced entry onwards, so distances stay
+// uniformly short. A lookup can stop as soon as it reaches an entry closer to
+// home than the key would be, and never probes further than the largest
+// distance in the table, which bounds misses as tightly as hits.
+// Removal shifts the following entries back by one instead of leaving
+// tombstones, so probe sequences never grow from churn.
+// Hash maps a key to a 64-bit hash (see hashFunctions.h). Distance is the
+// unsigned type storing each slot's probe distance: it bounds how far an
+// entry can sit from home, and a narrower type shrinks the per-slot metadata.
+template <typename U, typename Hash = WyHash, typename Distance = uint16_t>
+class RobinHoodHashTable {
+private:
+    struct Slot {
+        uint64_t hash;  // Full hash of the key, compared before the key
+        string key;
+        U value;
+    };
+
+    // Probe distances above this trigger a resize once the table is not
+    // nearly empty; below 1/8 load only a flood of colliding hashes gets
+    // here, and growing would not separate them
+    static constexpr size_t PROBE_LIMIT = 64;
+
+    // Largest probe distance a slot can record
+    static constexpr size_t MAX_DISTANCE = numeric_limits<Distance>::max();
+    static_assert(is_unsigned_v<Distance> && MAX_DISTANCE > PROBE_LIMIT,
+                  "Distance must be an unsigned type that can exceed PROBE_LIMIT");
+
+    size_t capacity = 0;        // Number of slots, a power of two
+    size_t size = 0;            // Number of stored elements
+    Distance maxProbe = 0;      // Largest distance stored since the last rehash
+    Distance *dist = nullptr;   // Probe distance + 1 per slot, 0 for empty
+    Slot *slots = nullptr;      // Raw slot storage, constructed only when used
+    Hash hasher;                // Hash function object
+
+    uint64_t hashKey(string_view key) const { return hasher(key); }
+
+    // Largest number of elements the table may hold at a capacity (7/8 load)
+    static size_t maxLoad(size_t cap) { return cap - cap / 8; }
+
+    // Private method to find the slot holding key, or capacity if absent
+    size_t find(string_view key, uint64_t hash) const;
+
+    // Private method to check, without moving anything, that inserting an
+    // entry with this hash keeps every probe distance within MAX_DISTANCE
+    bool insertFits(uint64_t hash) const;
+
+    // Private method to place an entry known to be absent. Throws
+    // std::length_error, leaving the table unchanged, if a probe distance
+    // would overflow
+    void insertNew(Slot &&entry);
+
+    // Private method to place an entry known to be absent and to fit
+    void displaceInsert(Slot &&entry);
+
+    void allocate(size_t newCapacity);
+    void release();
+    void resize(size_t newCapacity);
+
+public:
+    // Constructor to initialize the RobinHoodHashTable
+    RobinHoodHashTable() { allocate(128); };
+
+    // Constructor taking a configured (e.g. seeded) hasher
+    explicit RobinHoodHashTable(const Hash &hasher) : hasher{hasher} { allocate(128); };
+
+    RobinHoodHashTable(const RobinHoodHashTable &) = delete;
+    RobinHoodHashTable &operator=(const RobinHoodHashTable &) = delete;
+
+    // Method to check if a key exists in the RobinHoodHashTable
+    bool has(string_view key);
+
+    // Method to get the value associated with a key
+    U get(string_view key);
+
+    // Method to set a key-value pair in the RobinHoodHashTable
+    void set(const string &key, const U &value);
+
+    // Method to remove a key-value pair from the RobinHoodHashTable
+    bool remove(string_view key);
+
+    // Method to get the number of key-value pairs
+    size_t get_length() const { return size; }
+
+    // Method to get the longest probe any lookup can make: an upper bound
+    // that only shrinks when the table is rehashed
+    size_t max_probe_length() const { return maxProbe; }
+
+    ~RobinHoodHashTable() { release(); };
+};
+
+// Definition of the allocate method
+template <typename U, typename Hash, typename Distance>
+void RobinHoodHashTable<U, Hash, Distance>::allocate(size_t newCapacity) {
+    capacity = newCapacity;
+    dist = new Distance[capacity]();
+    slots = static_cast<Slot *>(::operator new(capacity * sizeof(Slot)));
+    size = 0;
+    maxProbe = 0;
+}
+
+// Definition of the release method: destroy live slots and free the arrays
+template <typename U, typename Hash, typename Distance>
+void RobinHoodHashTable<U, Hash, Distance>::release() {
+    for (size_t i = 0; i < capacity; ++i) {
+        if (dist[i] != 0) {
+            slots[i].~Slot();
+        }
+    }
+    ::operator delete(slots);
+    delete[] dist;
+    slots = nullptr;
+    dist = nullptr;
+}
+
+// Definition of the find method
+template <typename U, typename Hash, typename Distance>
+size_t RobinHoodHashTable<U, Hash, Distance>::find(string_view key, uint64_t hash) const {
+    size_t mask = capacity - 1;
+    size_t index = hash & mask;
+
+    for (size_t d = 1; d <= maxProbe; ++d) {
+        // An empty slot or an entry closer to home means the key would have
+        // been placed here already
+        if (dist[index] < d) {
+            return capacity;
+        }
+        if (slots[index].hash == hash && slots[index].key == key) {
+            return index;
+        }
+        index = (index + 1) & mask;
+    }
+    return capacity;
+}
+
+// Definition of the insertFits method: replays displaceInsert on the
+// distances alone, following the carried distance through every displacement
+template <typename U, typename Hash, typename Distance>
+bool RobinHoodHashTable<U, Hash, Distance>::insertFits(uint64_t hash) const {
+    size_t mask = capacity - 1;
+    size_t index = hash & mask;
+    size_t d = 1;
+
+    while (dist[index] != 0) {
+        if (dist[index] < d) {
+            d = dist[index]; // The displaced resident carries on from here
+        }
+        if (d == MAX_DISTANCE) {
+            return false;
+        }
+        index = (index + 1) & mask;
+        d++;
+    }
+    return true;
+}
+
+// Definition of the insertNew method: checks first, then displaces, so an
+// overflow is reported before any resident entry has moved
+template <typename U, typename Hash, typename Distance>
+void RobinHoodHashTable<U, Hash, Distance>::insertNew(Slot &&entry) {
+    // Every entry an insert moves lands right behind one at least as far from
+    // home, so an insert lengthens the longest probe by at most one and only
+    // needs the exact check once maxProbe is at the limit
+    if (maxProbe == MAX_DISTANCE && !insertFits(entry.hash)) {
+        throw length_error("RobinHoodHashTable probe distance overflow");
+    }
+    displaceInsert(std::move(entry));
+}
+
+// Definition of the displaceInsert method
+template <typename U, typename Hash, typename Distance>
+void RobinHoodHashTable<U, Hash, Distance>::displaceInsert(Slot &&entry) {
+    size_t mask = capacity - 1;
+    size_t index = entry.hash & mask;
+    Slot carried = std::move(entry);
+    Distance d = 1;
+
+    while (dist[index] != 0) {
+        if (dist[index] < d) {
+            // Take from the rich: the resident is closer to home, so it moves on
+            swap(carried, slots[index]);
+            swap(d, dist[index]);
+            maxProbe = max(maxProbe, dist[index]);
+        }
+        index = (index + 1) & mask;
+        d++;
+    }
+    new (&slots[index]) Slot(std::move(carried));
+    dist[index] = d;
+    maxProbe = max(maxProbe, d);
+    size++;
+}
+
+// Definition of the resize method: reinsert every live slot into fresh
+// arrays. Growing never lengthens the longest probe: the keys homed in any
+// run of slots of the larger table were homed in a run of the same length
+// before, so the entries fit without the check insertNew makes
+template <typename U, typename Hash, typename Distance>
+void RobinHoodHashTable<U, Hash, Distance>::resize(size_t newCapacity) {
+    Distance *oldDist = dist;
+    Slot *oldSlots = slots;
+    size_t oldCapacity = capacity;
+
+    allocate(newCapacity);
+
+    for (size_t i = 0; i < oldCapacity; ++i) {
+        if (oldDist[i] != 0) {
+            displaceInsert(std::move(oldSlots[i]));
+            oldSlots[i].~Slot();
+        }
+    }
+
+    ::operator delete(oldSlots);
+    delete[] oldDist;
+}
+
+// Definition of the has method
+template <typename U, typename Hash, typename Distance>
+bool RobinHoodHashTable<U, Hash, Distance>::has(string_view key) {
+    return find(key, hashKey(key)) != capacity;
+}
+
+// Definition of the get method
+template <typename U, typename Hash, typename Distance>
+U RobinHoodHashTable<U, Hash, Distance>::get(string_view key) {
+    size_t index = find(key, hashKey(key));
+    if (index != capacity) {
+        return slots[index].value; // Return the value associated with the key
+    }
+    return U{}; // Return default value if key is not found
+}
+
+// Definition of the set method
+template <typename U, typename Hash, typename Distance>
+void RobinHoodHashTable<U, Hash, Distance>::set(const string &key, const U &value) {
+    uint64_t hash = hashKey(key);
+    size_t index = find(key, hash);
+
+    if (index != capacity) {
+        slots[index].value = value; // Key already present, update in place
+        return;
+    }
+
+    if (size + 1 > maxLoad(capacity)) {
+        resize(capacity * 2);
+    }
+    insertNew(Slot{hash, key, value});
+
+    if (maxProbe > PROBE_LIMIT && size * 8 >= capacity) {
+        resize(capacity * 2); // Rehashing also recomputes maxProbe
+    }
+}
+
+// Definition of the remove method
+template <typename U, typename Hash, typename Distance>
+bool RobinHoodHashTable<U, Hash, Distance>::remove(string_view key) {
+    size_t index = find(key, hashKey(key));
+    if (index == capacity) {
+        return false;
+    }
+
+    // Backward shift: pull every following displaced entry one slot closer
+    // to home until an empty slot or an entry already at home
+    size_t mask = capacity - 1;
+    slots[index].~Slot();
+    size_t next = (index + 1) & mask;
+    while (dist[next] > 1) {
+        new (&slots[index]) Slot(std::move(slots[next]));
+        slots[next].~Slot();
+        dist[index] = dist[next] - 1;
+        index = next;
+        next = (next + 1) & mask;
+    }
+    dist[index] = 0;
+    size--;
+    return true;
+}
+
+#endif // ROBIN_HOOD_HASH_TABLE_H
@@ -0,0 +1,114 @@
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include "robinHoodHashTable.h"
+
+using namespace std;
+
+// Hasher that maps every key into a handful of home slots
+struct ClusteringHash {
+    uint64_t operator()(string_view key) const { return WyHash()(key) & 7; }
+};
+
+// Hasher that sends every key to the same home slot
+struct ConstantHash {
+    uint64_t operator()(string_view) const { return 0; }
+};
+
+// Function to run tests for the RobinHoodHashTable class
+void runTests() {
+    // Test case 1: Insertion and retrieval
+    RobinHoodHashTable<int> table;
+    table.set("key1", 10);
+    table.set("key2", 20);
+    table.set("key3", 30);
+    assert(table.get("key1") == 10);
+    assert(table.get("key2") == 20);
+    assert(table.get("key3") == 30);
+
+    // Test case 2: Updating existing value
+    table.set("key1", 50);
+    assert(table.get("key1") == 50);
+    assert(table.get_length() == 3);
+
+    // Test case 3: Removal
+    assert(table.remove("key2") == true);
+    assert(table.remove("key2") == false);
+    assert(table.get("key2") == 0); // Removed, should return default value (0)
+    assert(table.has("key1") == true);
+    assert(table.has("key2") == false);
+
+    // Test case 4: Growth past several resizes keeps probes short
+    for (int i = 0; i < 10000; ++i) {
+        table.set("key" + to_string(i), i * 10);
+    }
+    for (int i = 0; i < 10000; ++i) {
+        assert(table.get("key" + to_string(i)) == i * 10);
+    }
+    assert(table.max_probe_length() <= 64);
+
+    // Test case 5: Backward-shift deletion under heavy churn
+    for (int i = 0; i < 10000; i += 2) {
+        assert(table.remove("key" + to_string(i)) == true);
+    }
+    for (int round = 0; round < 5; ++round) {
+        for (int i = 0; i < 2000; ++i) {
+            table.set("churn" + to_string(i), i);
+        }
+        for (int i = 0; i < 2000; ++i) {
+            assert(table.remove("churn" + to_string(i)) == true);
+        }
+    }
+    for (int i = 0; i < 10000; ++i) {
+        assert(table.has("key" + to_string(i)) == (i % 2 == 1));
+    }
+    assert(table.get_length() == 5000);
+
+    // Test case 6: Long clusters of colliding home slots still work
+    RobinHoodHashTable<int, ClusteringHash> clustered;
+    for (int i = 0; i < 100; ++i) {
+        clustered.set(to_string(i), i);
+    }
+    for (int i = 0; i < 100; i += 3) {
+        assert(clustered.remove(to_string(i)) == true);
+    }
+    for (int i = 0; i < 100; ++i) {
+        assert(clustered.get(to_string(i)) == (i % 3 == 0 ? 0 : i));
+    }
+    assert(clustered.has("missing") == false);
+
+    // Test case 7: An insert that would overflow a probe distance throws and
+    // leaves the table unchanged (8-bit distances reach the limit quickly)
+    RobinHoodHashTable<int, ConstantHash, uint8_t> degenerate;
+    int inserted = 0;
+    bool thrown = false;
+    try {
+        for (; inserted < 1000; ++inserted) {
+            degenerate.set("key" + to_string(inserted), inserted);
+        }
+    } catch (const length_error &) {
+        thrown = true;
+    }
+    assert(thrown == true);
+    assert(inserted == 255);
+    assert(degenerate.get_length() == 255);
+    for (int i = 0; i < inserted; ++i) {
+        assert(degenerate.get("key" + to_string(i)) == i);
+    }
+    assert(degenerate.has("key255") == false);
+
+    // Test case 8: Removing an entry makes room again
+    assert(degenerate.remove("key0") == true);
+    degenerate.set("key255", 255);
+    assert(degenerate.get("key255") == 255);
+    assert(degenerate.get("key254") == 254);
+    assert(degenerate.get_length() == 255);
+}
+
+int main() {
+    runTests(); // Run the tests
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -1,6 +1,14 @@
 #include <iostream>
+#include <algorithm>
 #include <cassert>
+#include <cctype>
+#include <cstdint>
+#include <iterator>
+#include <sstream>
+#include <utility>
+#include <vector>
 #include "hashTable.h"
+#include "poolAllocator.h"
 
 
 using namespace std;
@@ -35,8 +43,832 @@ void runTests() {
     
 }
 
+// Function to run tests for the shipped hashers
+void runHasherTests() {
+    // Test case 1: Hashers are deterministic and seeds change the output
+    WyHash wy;
+    XxHash3 xx;
+    assert(wy("key1") == WyHash()("key1"));
+    assert(xx("key1") == XxHash3()("key1"));
+    assert(WyHash(1)("key1") != WyHash(2)("key1"));
+    assert(XxHash3(1)("key1") != XxHash3(2)("key1"));
+
+    // Test case 2: Every length path produces distinct hashes for shared prefixes
+    for (size_t len = 0; len < 100; ++len) {
+        string a(len, 'k'), b = a + "1";
+        assert(wy(a) != wy(b));
+        assert(xx(a) != xx(b));
+    }
+
+    // Test case 3: Tables work with any hasher and seed
+    HashTable<int, XxHash3> seeded(XxHash3(42));
+    for (int i = 0; i < 150; ++i) {
+        seeded.set("key" + to_string(i), i);
+    }
+    for (int i = 0; i < 150; ++i) {
+        assert(seeded.get("key" + to_string(i)) == i);
+    }
+}
+
+// Hasher that counts how often it is called
+struct CountingHash {
+    static size_t calls;
+    uint64_t operator()(string_view key) const {
+        calls++;
+        return WyHash()(key);
+    }
+};
+size_t CountingHash::calls = 0;
+
+// Function to run tests for cached hashes
+void runCachedHashTests() {
+    // Test case 1: Growing the table reuses the hash cached in every node
+    for (bool incremental : {false, true}) {
+        HashTable<int, CountingHash> hashTable;
+        hashTable.set_incremental_rehash(incremental);
+        CountingHash::calls = 0;
+        for (int i = 0; i < 1000; ++i) {
+            hashTable.set("key" + to_string(i), i); // Several resizes happen here
+        }
+        assert(CountingHash::calls == 1000); // Exactly one hash per set
+        for (int i = 0; i < 1000; ++i) {
+            assert(hashTable.get("key" + to_string(i)) == i);
+        }
+    }
+}
+
+// PoolAllocator that counts how many pools are created
+static size_t poolsCreated = 0;
+
+template <typename T>
+struct CountingPoolAllocator : PoolAllocator<T> {
+    CountingPoolAllocator() { poolsCreated++; }
+    template <typename V>
+    CountingPoolAllocator(const CountingPoolAllocator<V> &other) : PoolAllocator<T>(other) {}
+};
+
+// Allocator that counts every allocation a table makes for its Nodes and Buckets
+static size_t tableAllocations = 0;
+
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template <typename V>
+    CountingAllocator(const CountingAllocator<V> &) {}
+
+    T *allocate(size_t n) {
+        tableAllocations++;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+    template <typename V>
+    bool operator==(const CountingAllocator<V> &) const { return true; }
+    template <typename V>
+    bool operator!=(const CountingAllocator<V> &) const { return false; }
+};
+
+// Function to run tests for pool-allocated tables
+void runPoolAllocatorTests() {
+    // Test case 1: Freed blocks are recycled before new slab space is used
+    SlabPool pool;
+    void *first = pool.allocate(40);
+    void *second = pool.allocate(40);
+    assert(first != second);
+    pool.deallocate(first, 40);
+    assert(pool.allocate(40) == first);
+    assert(pool.slab_count() == 1);
+
+    // Test case 2: A table drawing Nodes and Buckets from one shared pool
+    PoolAllocator<char> alloc;
+    {
+        HashTable<int, WyHash, PoolAllocator<char>> hashTable(WyHash(), alloc);
+        for (int i = 0; i < 2000; ++i) {
+            hashTable.set("key" + to_string(i), i);
+        }
+        for (int i = 0; i < 2000; i += 2) {
+            assert(hashTable.remove("key" + to_string(i)) == true);
+        }
+        for (int i = 0; i < 2000; ++i) {
+            assert(hashTable.get("key" + to_string(i)) == (i % 2 == 1 ? i : 0));
+        }
+    }
+    size_t slabs = alloc.resource().slab_count();
+    assert(slabs > 0);
+
+    // Test case 3: Memory released by a destroyed table is reused by the next one
+    {
+        HashTable<int, WyHash, PoolAllocator<char>> hashTable(WyHash(), alloc);
+        for (int i = 0; i < 2000; ++i) {
+            hashTable.set("key" + to_string(i), i);
+        }
+    }
+    assert(alloc.resource().slab_count() == slabs);
+
+    // Test case 4: Over-aligned values bypass the pool but keep their alignment
+    struct alignas(64) CacheLine {
+        int value;
+    };
+    PoolAllocator<CacheLine> lineAlloc;
+    CacheLine *line = lineAlloc.allocate(1);
+    CacheLine *lines = lineAlloc.allocate(3);
+    assert(reinterpret_cast<uintptr_t>(line) % 64 == 0);
+    assert(reinterpret_cast<uintptr_t>(lines) % 64 == 0);
+    lineAlloc.deallocate(lines, 3);
+    lineAlloc.deallocate(line, 1);
+    PoolAllocator<char> tableAlloc;
+    HashTable<CacheLine, WyHash, PoolAllocator<char>> aligned(WyHash(), tableAlloc);
+    for (int i = 0; i < 200; ++i) {
+        aligned.set("key" + to_string(i), CacheLine{i});
+    }
+    assert(aligned.get("key150").value == 150);
+
+    // Test case 5: A default-constructed table keeps Nodes and Buckets in one pool
+    poolsCreated = 0;
+    HashTable<int, WyHash, CountingPoolAllocator<char>> pooled;
+    HashTable<int, WyHash, CountingPoolAllocator<char>> seeded{WyHash(7)};
+    pooled.set("key", 1);
+    assert(poolsCreated == 2);
+    assert(pooled.get("key") == 1);
+}
+
+// Range yielding keys by value, like a transform view
+struct GeneratedKeys {
+    struct iterator {
+        int i;
+        string operator*() const { return "key" + to_string(i * 70); }
+        iterator &operator++() {
+            ++i;
+            return *this;
+        }
+        bool operator!=(const iterator &other) const { return i != other.i; }
+    };
+    int count;
+    iterator begin() const { return iterator{0}; }
+    iterator end() const { return iterator{count}; }
+};
+
+// Range yielding string_view slices of a buffer by value, like a tokenizer
+struct SlicedKeys {
+    struct iterator {
+        string_view rest;
+        string_view operator*() const { return rest.substr(0, rest.find(' ')); }
+        iterator &operator++() {
+            size_t space = rest.find(' ');
+            rest = space == string_view::npos ? string_view() : rest.substr(space + 1);
+            return *this;
+        }
+        bool operator!=(const iterator &other) const { return rest.data() != other.rest.data(); }
+    };
+    string_view buffer;
+    iterator begin() const { return iterator{buffer}; }
+    iterator end() const { return iterator{string_view()}; }
+};
+
+// Hasher that counts keys whose bytes lie outside buffer, to check that
+// lookups hash the caller's bytes instead of a copy
+struct InBufferHash {
+    static string_view buffer;
+    static size_t copies;
+    uint64_t operator()(string_view key) const {
+        if (key.data() < buffer.data() || key.data() + key.size() > buffer.data() + buffer.size()) {
+            copies++;
+        }
+        return WyHash()(key);
+    }
+};
+string_view InBufferHash::buffer;
+size_t InBufferHash::copies = 0;
+
+// Function to run tests for the bulk APIs
+void runBulkTests() {
+    // Test case 1: insert_bulk pre-sizes and inserts every entry
+    vector<pair<string, int>> entries;
+    for (int i = 0; i < 5000; ++i) {
+        entries.emplace_back("key" + to_string(i), i);
+    }
+    HashTable<int> hashTable;
+    hashTable.insert_bulk(entries);
+    for (int i = 0; i < 5000; ++i) {
+        assert(hashTable.get("key" + to_string(i)) == i);
+    }
+
+    // Test case 2: get_many returns values in key order, defaults for misses
+    vector<string> keys;
+    for (int i = 0; i < 100; ++i) {
+        keys.push_back("key" + to_string(i * 70)); // Keys past 4999 are missing
+    }
+    vector<int> values;
+    hashTable.get_many(keys, back_inserter(values));
+    assert(values.size() == keys.size());
+    for (int i = 0; i < 100; ++i) {
+        assert(values[i] == (i * 70 < 5000 ? i * 70 : 0));
+    }
+
+    // Test case 3: get_many over keys yielded by value keeps each key alive
+    vector<int> generated;
+    hashTable.get_many(GeneratedKeys{100}, back_inserter(generated));
+    assert(generated == values);
+
+    // Test case 4: get_many over string_view slices copies no key and
+    // allocates nothing
+    string buffer = "key0 key70 key140 missing-key-long-enough-to-allocate";
+    HashTable<int, InBufferHash, CountingAllocator<char>> sliced;
+    for (int i = 0; i < 150; i += 70) {
+        sliced.set("key" + to_string(i), i);
+    }
+    InBufferHash::buffer = buffer;
+    InBufferHash::copies = 0;
+    tableAllocations = 0;
+    int found[4];
+    sliced.get_many(SlicedKeys{buffer}, found);
+    assert(InBufferHash::copies == 0);
+    assert(tableAllocations == 0);
+    assert(found[0] == 0 && found[1] == 70 && found[2] == 140 && found[3] == 0);
+
+    // Test case 5: reserve followed by inserts, including updates
+    HashTable<int> reserved;
+    reserved.reserve(1000);
+    for (int i = 0; i < 1000; ++i) {
+        reserved.set("key" + to_string(i % 500), i);
+    }
+    assert(reserved.get("key0") == 500);
+}
+
+// Function to run tests for load-factor accounting and growth policies
+template <typename Growth>
+void runGrowthPolicyTest() {
+    HashTable<int, WyHash, std::allocator<char>, Growth> hashTable;
+    size_t initial = hashTable.bucket_count();
+
+    // Test case 1: Length counts entries, updates do not change it
+    for (int i = 0; i < 2000; ++i) {
+        hashTable.set("key" + to_string(i), i);
+        hashTable.set("key" + to_string(i), i + 1);
+    }
+    assert(hashTable.get_length() == 2000);
+    assert(hashTable.load_factor() <= hashTable.max_load_factor());
+    assert(hashTable.bucket_count() > initial);
+    for (int i = 0; i < 2000; ++i) {
+        assert(hashTable.get("key" + to_string(i)) == i + 1);
+    }
+
+    // Test case 2: Removing decreases the length, missing keys do not
+    assert(hashTable.remove("key0") == true);
+    assert(hashTable.remove("key0") == false);
+    assert(hashTable.get_length() == 1999);
+
+    // Test case 3: Lowering the maximum load factor grows the table right away
+    hashTable.max_load_factor(0.25f);
+    assert(hashTable.load_factor() <= 0.25f);
+    assert(hashTable.get("key1999") == 2000);
+}
+
+void runLoadFactorTests() {
+    runGrowthPolicyTest<PowerOfTwoGrowth>();
+    runGrowthPolicyTest<OneAndHalfGrowth>();
+    runGrowthPolicyTest<PrimeGrowth>();
+
+    // Test case 4: Policies produce their kind of bucket counts
+    assert(PowerOfTwoGrowth::roundUp(100) == 128);
+    assert(OneAndHalfGrowth::grow(128) == 192);
+    assert(PrimeGrowth::roundUp(100) == 193);
+    assert(OneAndHalfGrowth::index(~0ull, 192) == 191);
+
+    // Test case 5: Invalid load factors are rejected
+    HashTable<int> hashTable;
+    bool thrown = false;
+    try {
+        hashTable.max_load_factor(0.0f);
+    } catch (const invalid_argument &) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+// Function to run tests for shrinking
+void runShrinkTests() {
+    // Test case 1: Tables keep their peak size unless asked
+    HashTable<int> hashTable;
+    for (int i = 0; i < 10000; ++i) {
+        hashTable.set("key" + to_string(i), i);
+    }
+    size_t peak = hashTable.bucket_count();
+    for (int i = 0; i < 9900; ++i) {
+        hashTable.remove("key" + to_string(i));
+    }
+    assert(hashTable.bucket_count() == peak);
+
+    // Test case 2: compact() right-sizes and keeps every entry
+    hashTable.compact();
+    assert(hashTable.bucket_count() < peak);
+    assert(hashTable.load_factor() <= hashTable.max_load_factor());
+    for (int i = 9900; i < 10000; ++i) {
+        assert(hashTable.get("key" + to_string(i)) == i);
+    }
+
+    // Test case 3: Shrink-on-delete follows eviction waves, in both resize modes
+    for (bool incremental : {false, true}) {
+        HashTable<int> shrinking;
+        shrinking.set_shrink_on_delete(true);
+        shrinking.set_incremental_rehash(incremental);
+        for (int i = 0; i < 10000; ++i) {
+            shrinking.set("key" + to_string(i), i);
+        }
+        size_t grown = shrinking.bucket_count();
+        for (int i = 0; i < 9990; ++i) {
+            assert(shrinking.remove("key" + to_string(i)) == true);
+        }
+        assert(shrinking.bucket_count() < grown / 8);
+        for (int i = 0; i < 10000; ++i) {
+            assert(shrinking.get("key" + to_string(i)) == (i >= 9990 ? i : 0));
+        }
+    }
+}
+
+// Function to run tests for iteration
+void runIterationTests() {
+    for (bool incremental : {false, true}) {
+        HashTable<int> hashTable;
+        hashTable.set_incremental_rehash(incremental);
+        for (int i = 0; i < 1000; ++i) {
+            hashTable.set("key" + to_string(i), i);
+        }
+
+        // Test case 1: Iterators visit every pair exactly once, even mid-migration
+        vector<int> seen(1000, 0);
+        for (auto [key, value] : hashTable) {
+            assert(key == "key" + to_string(value));
+            seen[value]++;
+        }
+        for (int count : seen) {
+            assert(count == 1);
+        }
+
+        // Test case 2: Values can be updated through iterators
+        for (auto [key, value] : hashTable) {
+            value *= 2;
+        }
+        assert(hashTable.get("key21") == 42);
+
+        // Test case 3: for_each walks the same pairs
+        size_t visited = 0;
+        long long sum = 0;
+        hashTable.for_each([&](const string &, int &value) {
+            visited++;
+            sum += value;
+        });
+        assert(visited == hashTable.get_length());
+        assert(sum == 999LL * 1000);
+
+        // Test case 4: Rebuilding another table from an iteration
+        HashTable<int> copy;
+        copy.insert_bulk(hashTable);
+        assert(copy.get_length() == 1000 && copy.get("key999") == 1998);
+    }
+
+    // Test case 5: Empty tables have begin() == end()
+    HashTable<int> empty;
+    assert(empty.begin() == empty.end());
+
+    // Test case 6: Iterators are default-constructible, as forward iterators must be
+    HashTable<int>::iterator first;
+    HashTable<int>::iterator second{};
+    HashTable<int>::const_iterator third;
+    assert(first == second);
+    assert(!(third != HashTable<int>::const_iterator()));
+}
+
+// Function to run tests for incremental resizing
+void runIncrementalRehashTests() {
+    HashTable<int> hashTable;
+    hashTable.set_incremental_rehash(true);
+
+    // Test case 1: Every key stays reachable while buckets migrate
+    bool sawRehash = false;
+    for (int i = 0; i < 5000; ++i) {
+        hashTable.set("key" + to_string(i), i);
+        sawRehash = sawRehash || hashTable.rehashing();
+        assert(hashTable.get("key" + to_string(i / 2)) == i / 2);
+    }
+    assert(sawRehash);
+
+    // Test case 2: Updates and removals mid-migration hit the right bucket
+    for (int i = 0; i < 5000; i += 3) {
+        hashTable.set("key" + to_string(i), -i);
+    }
+    for (int i = 1; i < 5000; i += 3) {
+        assert(hashTable.remove("key" + to_string(i)) == true);
+    }
+    for (int i = 0; i < 5000; ++i) {
+        string key = "key" + to_string(i);
+        if (i % 3 == 0) {
+            assert(hashTable.get(key) == -i);
+        } else if (i % 3 == 1) {
+            assert(hashTable.has(key) == false);
+        } else {
+            assert(hashTable.get(key) == i);
+        }
+    }
+
+    // Test case 3: Switching the mode off drains the migration
+    hashTable.set_incremental_rehash(false);
+    assert(hashTable.rehashing() == false);
+    assert(hashTable.get("key2") == 2);
+}
+
+// Function to run tests for string_view lookups
+void runStringViewTests() {
+    HashTable<int, InBufferHash, CountingAllocator<char>> hashTable;
+    hashTable.set("alpha", 1);
+    hashTable.set("beta", 2);
+    hashTable.set("delta", 4);
+
+    // Test case 1: Keys sliced out of a larger buffer, without copies
+    const char *buffer = "GET alpha beta gamma";
+    string_view request(buffer);
+    InBufferHash::buffer = request;
+    InBufferHash::copies = 0;
+    tableAllocations = 0;
+    assert(hashTable.get(request.substr(4, 5)) == 1);
+    assert(hashTable.has(request.substr(10, 4)) == true);
+    assert(hashTable.has(request.substr(15, 5)) == false);
+
+    // Test case 2: Removal through a string_view
+    assert(hashTable.remove(request.substr(10, 4)) == true);
+    assert(InBufferHash::copies == 0);
+    assert(tableAllocations == 0);
+    assert(hashTable.has("beta") == false);
+
+    // Test case 3: const char* keys are viewed in place, without copies
+    const char *name = "delta";
+    InBufferHash::buffer = name;
+    InBufferHash::copies = 0;
+    tableAllocations = 0;
+    assert(hashTable.has(name) == true);
+    assert(hashTable.get(name) == 4);
+    assert(hashTable.remove(name) == true);
+    assert(InBufferHash::copies == 0);
+    assert(tableAllocations == 0);
+    assert(hashTable.has("delta") == false);
+}
+
+// Case-insensitive comparison for a table keyed by lowercase-hashed strings
+struct CaseInsensitiveHash {
+    uint64_t operator()(string_view key) const {
+        string lower(key);
+        for (char &c : lower) {
+            c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+        }
+        return WyHash()(lower);
+    }
+};
+
+struct CaseInsensitiveEqual {
+    bool operator()(string_view a, string_view b) const {
+        if (a.size() != b.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (tolower(static_cast<unsigned char>(a[i])) != tolower(static_cast<unsigned char>(b[i]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+void runGenericKeyTests() {
+    // Test case 1: Integer keys use IntegerHash and survive several resizes
+    BasicHashTable<uint64_t, int> ids;
+    for (uint64_t i = 0; i < 1000; ++i) {
+        ids.set(i * 4096, static_cast<int>(i));
+    }
+    assert(ids.get_length() == 1000);
+    assert(ids.get(4096 * 7) == 7);
+    assert(ids.has(4096 * 7 + 1) == false);
+    assert(ids.remove(0) == true);
+    assert(ids.has(0) == false);
+
+    // Test case 2: 128-bit IDs differing only in the high half
+    BasicHashTable<unsigned __int128, int> wide;
+    unsigned __int128 high = static_cast<unsigned __int128>(1) << 64;
+    wide.set(high, 1);
+    wide.set(high * 2, 2);
+    wide.set(1, 3);
+    assert(wide.get(high) == 1);
+    assert(wide.get(high * 2) == 2);
+    assert(wide.get(1) == 3);
+
+    // Test case 3: Integers hash by value regardless of width
+    IntegerHash hasher;
+    assert(hasher(5) == hasher(5ull));
+    assert(hasher(static_cast<unsigned __int128>(5)) == hasher(5u));
+    assert(hasher(-1) == hasher(-1LL));
+    assert(hasher(static_cast<__int128>(-1)) == hasher(-1LL));
+    assert(hasher(static_cast<__int128>(INT64_MIN)) == hasher(INT64_MIN));
+    assert(hasher(static_cast<__int128>(INT64_MIN) - 1) != hasher(INT64_MAX));
+
+    // Test case 4: No 128-bit family collapses to one hash, e.g. a high half
+    // or (unseeded) a low half equal to one of IntegerHash's multipliers
+    const uint64_t mulA = 0x2d358dccaa6c78a5ull;
+    const uint64_t mulB = 0x8bb84b93962eacc9ull;
+    vector<uint64_t> fixedHigh;
+    vector<uint64_t> fixedLow;
+    for (uint64_t i = 1; i <= 1000; ++i) {
+        fixedHigh.push_back(hasher((static_cast<unsigned __int128>(mulB) << 64) | i));
+        fixedLow.push_back(hasher((static_cast<unsigned __int128>(i) << 64) | mulA));
+    }
+    sort(fixedHigh.begin(), fixedHigh.end());
+    sort(fixedLow.begin(), fixedLow.end());
+    assert(adjacent_find(fixedHigh.begin(), fixedHigh.end()) == fixedHigh.end());
+    assert(adjacent_find(fixedLow.begin(), fixedLow.end()) == fixedLow.end());
+
+    // Test case 5: Custom Hash and KeyEqual
+    BasicHashTable<string, int, CaseInsensitiveHash, CaseInsensitiveEqual> headers;
+    headers.set("Content-Type", 1);
+    headers.set("content-type", 2);
+    assert(headers.get_length() == 1);
+    assert(headers.get("CONTENT-TYPE") == 2);
+
+    // Test case 6: Iteration yields the typed key
+    int sum = 0;
+    for (auto entry : ids) {
+        sum += static_cast<int>(entry.first / 4096) == entry.second;
+    }
+    assert(sum == 999);
+}
+
+// Value type that counts how often it is copied
+struct CopyCounter {
+    static int copies;
+    vector<int> payload;
+
+    CopyCounter() = default;
+    explicit CopyCounter(size_t n) : payload(n, 1) {}
+    CopyCounter(const CopyCounter &other) : payload{other.payload} { copies++; }
+    CopyCounter(CopyCounter &&other) noexcept = default;
+    CopyCounter &operator=(const CopyCounter &other) {
+        payload = other.payload;
+        copies++;
+        return *this;
+    }
+    CopyCounter &operator=(CopyCounter &&other) noexcept = default;
+};
+
+int CopyCounter::copies = 0;
+
+void runMoveTests() {
+    HashTable<CopyCounter> hashTable;
+    CopyCounter::copies = 0;
+
+    // Test case 1: Moving set copies neither key nor value
+    string key = "blob";
+    hashTable.set(std::move(key), CopyCounter(1000));
+    assert(CopyCounter::copies == 0);
+
+    // Test case 2: try_emplace constructs in place and leaves existing keys alone
+    assert(hashTable.try_emplace("vec", 64) == true);
+    assert(hashTable.try_emplace("vec", 8) == false);
+    assert(CopyCounter::copies == 0);
+
+    // Test case 3: insert_or_assign moves into both new and existing pairs
+    CopyCounter big(500);
+    assert(hashTable.insert_or_assign("blob", std::move(big)) == false);
+    assert(hashTable.insert_or_assign(string("fresh"), CopyCounter(3)) == true);
+    assert(CopyCounter::copies == 0);
+
+    // Test case 4: Values survive the resizes triggered by many emplaces
+    for (int i = 0; i < 500; ++i) {
+        hashTable.try_emplace(to_string(i), static_cast<size_t>(i));
+    }
+    assert(CopyCounter::copies == 0);
+    assert(hashTable.get_length() == 503);
+    assert(hashTable.get("blob").payload.size() == 500); // get returns by value: one copy
+    assert(hashTable.get("vec").payload.size() == 64);
+
+    // Test case 5: Copying set still copies
+    CopyCounter::copies = 0;
+    CopyCounter value(2);
+    hashTable.set("copied", value);
+    assert(CopyCounter::copies == 1);
+}
+
+void runUpsertTests() {
+    // Test case 1: Counting words with a single probe per word
+    CountingHash::calls = 0;
+    HashTable<int, CountingHash> counts;
+    vector<string> words = {"a", "b", "a", "c", "a", "b"};
+    for (const string &word : words) {
+        counts.get_or_insert(word)++;
+    }
+    assert(CountingHash::calls == words.size());
+    assert(counts.get("a") == 3);
+    assert(counts.get("b") == 2);
+    assert(counts.get("c") == 1);
+    assert(counts.get_length() == 3);
+
+    // Test case 2: update inserts a default value, then modifies in place
+    CountingHash::calls = 0;
+    assert(counts.update("d", [](int &n) { n += 10; }) == true);
+    assert(counts.update("a", [](int &n) { n *= 2; }) == false);
+    assert(CountingHash::calls == 2);
+    assert(counts.get("d") == 10);
+    assert(counts.get("a") == 6);
+
+    // Test case 3: References stay valid across resizes
+    HashTable<int> table;
+    int &first = table.get_or_insert("first");
+    first = 42;
+    for (int i = 0; i < 1000; ++i) {
+        table.get_or_insert(to_string(i)) = i;
+    }
+    assert(first == 42);
+    assert(table.get("first") == 42);
+    assert(table.get("999") == 999);
+}
+
+void runBloomFilterTests() {
+    // Test case 1: The filter never rejects an inserted hash
+    BlockedBloomFilter filter(1000);
+    for (uint64_t i = 0; i < 1000; ++i) {
+        filter.insert(WyHash()(to_string(i)));
+    }
+    size_t falsePositives = 0;
+    for (uint64_t i = 0; i < 1000; ++i) {
+        assert(filter.may_contain(WyHash()(to_string(i))) == true);
+        falsePositives += filter.may_contain(WyHash()("absent" + to_string(i))) ? 1 : 0;
+    }
+    assert(falsePositives < 50);
+
+    // Test case 2: A filtered table gives the same answers through resizes
+    HashTable<int> hashTable;
+    hashTable.set_bloom_filter(true);
+    for (int i = 0; i < 5000; ++i) {
+        hashTable.set("key" + to_string(i), i);
+    }
+    for (int i = 0; i < 5000; ++i) {
+        assert(hashTable.has("key" + to_string(i)) == true);
+        assert(hashTable.get("key" + to_string(i)) == i);
+        assert(hashTable.has("other" + to_string(i)) == false);
+    }
+
+    // Test case 3: Removals, including enough to trigger rebuilds
+    for (int i = 0; i < 5000; i += 2) {
+        assert(hashTable.remove("key" + to_string(i)) == true);
+    }
+    for (int i = 0; i < 5000; ++i) {
+        assert(hashTable.has("key" + to_string(i)) == (i % 2 == 1));
+    }
+
+    // Test case 4: Enabling the filter on a filled table, with incremental rehash
+    HashTable<int> incremental;
+    incremental.set_incremental_rehash(true);
+    for (int i = 0; i < 2000; ++i) {
+        incremental.set(to_string(i), i);
+    }
+    incremental.set_bloom_filter(true);
+    for (int i = 2000; i < 4000; ++i) {
+        incremental.set(to_string(i), i);
+    }
+    for (int i = 0; i < 4000; ++i) {
+        assert(incremental.get(to_string(i)) == i);
+    }
+    assert(incremental.has("4000") == false);
+
+    // Test case 5: Mid-migration, keys not yet moved and keys already moved
+    // both pass the filter
+    HashTable<int> migrating;
+    migrating.set_incremental_rehash(true);
+    migrating.set_bloom_filter(true);
+    for (int i = 0; i < 4000; ++i) {
+        migrating.set("key" + to_string(i), i);
+        for (int j = i; j >= 0; j -= 97) {
+            assert(migrating.has("key" + to_string(j)) == true);
+        }
+    }
+
+    // Test case 6: get_many goes through the filter with the same answers,
+    // right after an incremental resize has started
+    HashTable<int> batched;
+    batched.set_incremental_rehash(true);
+    batched.set_bloom_filter(true);
+    vector<string> mixed;
+    int inserted = 0;
+    for (size_t buckets = batched.bucket_count(); batched.bucket_count() == buckets; ++inserted) {
+        batched.set("key" + to_string(inserted), inserted);
+        mixed.push_back("key" + to_string(inserted));
+        mixed.push_back("absent" + to_string(inserted));
+    }
+    vector<int> values(mixed.size());
+    batched.get_many(mixed, values.begin());
+    for (int i = 0; i < inserted; ++i) {
+        assert(values[2 * i] == i);
+        assert(values[2 * i + 1] == 0);
+    }
+}
+
+void runSinglyLinkedChainTests() {
+    using SlimTable = HashTable<int, WyHash, std::allocator<char>, PowerOfTwoGrowth, HashTableLinkedList>;
+
+    // Test case 1: Same behaviour as the default chain through resizes
+    SlimTable hashTable;
+    for (int i = 0; i < 5000; ++i) {
+        hashTable.set("key" + to_string(i), i);
+    }
+    for (int i = 0; i < 5000; i += 2) {
+        assert(hashTable.remove("key" + to_string(i)) == true);
+    }
+    for (int i = 0; i < 5000; ++i) {
+        assert(hashTable.get("key" + to_string(i)) == (i % 2 == 1 ? i : 0));
+    }
+    assert(hashTable.get_length() == 2500);
+
+    // Test case 2: Incremental rehash, iteration and upserts
+    SlimTable incremental;
+    incremental.set_incremental_rehash(true);
+    for (int i = 0; i < 1000; ++i) {
+        incremental.get_or_insert(to_string(i % 500)) += 1;
+    }
+    size_t count = 0;
+    for (auto entry : incremental) {
+        assert(entry.second == 2);
+        count++;
+    }
+    assert(count == 500);
+}
+
+#ifdef HASH_TABLE_STATS
+// Only built with -DHASH_TABLE_STATS
+void runStatsTests() {
+    HashTable<int> hashTable;
+    for (int i = 0; i < 1000; ++i) {
+        hashTable.set("key" + to_string(i), i);
+    }
+    hashTable.set("key0", 5);
+
+    // Test case 1: Write counters and resizes
+    const HashTableStats &stats = hashTable.stats();
+    assert(stats.inserts == 1000);
+    assert(stats.updates == 1);
+    assert(stats.resizes > 0);
+
+    // Test case 2: Lookup counters
+    hashTable.reset_stats();
+    assert(hashTable.has("key1") == true);
+    assert(hashTable.get("missing") == 0);
+    assert(hashTable.remove("key2") == true);
+    assert(stats.lookups == 2);
+    assert(stats.misses == 1);
+    assert(stats.probes >= 1);
+    assert(stats.removes == 1);
+
+    // Test case 3: The histogram accounts for every Bucket and entry
+    vector<size_t> histogram = hashTable.chain_length_histogram();
+    size_t buckets = 0;
+    size_t entries = 0;
+    for (size_t chain = 0; chain < histogram.size(); ++chain) {
+        buckets += histogram[chain];
+        entries += chain * histogram[chain];
+    }
+    assert(buckets == hashTable.bucket_count());
+    assert(entries == hashTable.get_length());
+
+    // Test case 4: dump_stats prints the counters and every non-empty histogram row
+    ostringstream out;
+    hashTable.dump_stats(out);
+    string dump = out.str();
+    assert(dump.find("  length 999, buckets " + to_string(hashTable.bucket_count()) + ",") != string::npos);
+    assert(dump.find("  lookups 2 (misses 1),") != string::npos);
+    assert(dump.find(", removes 1\n") != string::npos);
+    for (size_t chain = 0; chain < histogram.size(); ++chain) {
+        string row = "\n    " + to_string(chain) + ": " + to_string(histogram[chain]) + "\n";
+        assert((dump.find(row) != string::npos) == (histogram[chain] != 0));
+    }
+}
+#endif
+
 int main() {
     runTests(); // Run the tests
+    runHasherTests();
+    runCachedHashTests();
+    runPoolAllocatorTests();
+    runBulkTests();
+    runLoadFactorTests();
+    runShrinkTests();
+    runIterationTests();
+    runIncrementalRehashTests();
+    runStringViewTests();
+    runGenericKeyTests();
+    runMoveTests();
+    runUpsertTests();
+    runBloomFilterTests();
+    runSinglyLinkedChainTests();
+#ifdef HASH_TABLE_STATS
+    runStatsTests();
+#endif
     cout << "All tests passed successfully!" << endl;
     return 0;
 }
\ No newline at end of file